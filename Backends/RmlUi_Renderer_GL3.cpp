@@ -74,6 +74,32 @@ void main() {
 }
 )";
 
+static const char* shader_quad_vertex = RMLUI_SHADER_HEADER R"(
+uniform vec2 _translate;
+uniform mat4 _transform;
+
+in vec4 inRect;
+in vec4 inTexRect;
+in vec4 inColor0;
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+
+// Corners of the two triangles making up each quad instance, in the same order as the vertices generated for quads.
+const vec2 corners[6] = vec2[6](vec2(0, 0), vec2(0, 1), vec2(1, 0), vec2(1, 0), vec2(0, 1), vec2(1, 1));
+
+void main() {
+	vec2 corner = corners[gl_VertexID];
+	fragTexCoord = mix(inTexRect.xy, inTexRect.zw, corner);
+	fragColor = inColor0;
+
+	vec2 translatedPos = mix(inRect.xy, inRect.zw, corner) + _translate.xy;
+	vec4 outPos = _transform * vec4(translatedPos, 0, 1);
+
+	gl_Position = outPos;
+}
+)";
+
 static const char* shader_main_fragment_texture = RMLUI_SHADER_HEADER R"(
 uniform sampler2D _tex;
 in vec2 fragTexCoord;
@@ -86,6 +112,21 @@ void main() {
 	finalColor = fragColor * texColor;
 }
 )";
+static const char* shader_main_fragment_distance_field = RMLUI_SHADER_HEADER R"(
+uniform sampler2D _tex;
+uniform vec2 _distanceField;
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+void main() {
+	float distance = texture(_tex, fragTexCoord).a;
+	float width = max(_distanceField.y, 0.5 * fwidth(distance));
+	float alpha = smoothstep(_distanceField.x - width, _distanceField.x + width, distance);
+	finalColor = vec4(fragColor.rgb, fragColor.a * alpha);
+}
+)";
 static const char* shader_main_fragment_color = RMLUI_SHADER_HEADER R"(
 in vec2 fragTexCoord;
 in vec4 fragColor;
@@ -99,11 +140,11 @@ void main() {
 
 namespace Gfx {
 
-enum class ProgramUniform { Translate, Transform, Tex, Count };
-static const char* const program_uniform_names[(size_t)ProgramUniform::Count] = {"_translate", "_transform", "_tex"};
+enum class ProgramUniform { Translate, Transform, Tex, DistanceField, Count };
+static const char* const program_uniform_names[(size_t)ProgramUniform::Count] = {"_translate", "_transform", "_tex", "_distanceField"};
 
-enum class VertexAttribute { Position, Color0, TexCoord0, Count };
-static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count] = {"inPosition", "inColor0", "inTexCoord0"};
+enum class VertexAttribute { Position, Color0, TexCoord0, Rect, TexRect, Count };
+static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count] = {"inPosition", "inColor0", "inTexCoord0", "inRect", "inTexRect"};
 
 struct CompiledGeometryData {
 	Rml::TextureHandle texture;
@@ -111,7 +152,24 @@ struct CompiledGeometryData {
 	GLuint vbo;
 	GLuint ibo;
 	GLsizei draw_count;
+	GLenum index_type;
+	// Drawn as instanced quads, in which case the draw count is the number of quads.
+	bool quads;
+};
+
+#ifndef RMLUI_PLATFORM_EMSCRIPTEN
+// Ring buffers for streaming immediate geometry. Geometry is appended at the current offsets, and the buffers are orphaned when full.
+struct StreamBufferData {
+	GLuint vao;
+	GLuint quad_vao;
+	GLuint vbo;
+	GLuint ibo;
+	GLsizeiptr vertex_capacity;
+	GLsizeiptr index_capacity;
+	GLsizeiptr vertex_offset;
+	GLsizeiptr index_offset;
 };
+#endif
 
 struct ProgramData {
 	GLuint id;
@@ -121,9 +179,15 @@ struct ProgramData {
 struct ShadersData {
 	ProgramData program_color;
 	ProgramData program_texture;
+	ProgramData program_quad_color;
+	ProgramData program_quad_texture;
+	ProgramData program_distance_field;
+	ProgramData program_quad_distance_field;
 	GLuint shader_main_vertex;
+	GLuint shader_quad_vertex;
 	GLuint shader_main_fragment_color;
 	GLuint shader_main_fragment_texture;
+	GLuint shader_main_fragment_distance_field;
 };
 
 static void CheckGLError(const char* operation_name)
@@ -265,8 +329,10 @@ static bool CreateShaders(ShadersData& out_shaders)
 {
 	out_shaders = {};
 	GLuint& main_vertex = out_shaders.shader_main_vertex;
+	GLuint& quad_vertex = out_shaders.shader_quad_vertex;
 	GLuint& main_fragment_color = out_shaders.shader_main_fragment_color;
 	GLuint& main_fragment_texture = out_shaders.shader_main_fragment_texture;
+	GLuint& main_fragment_distance_field = out_shaders.shader_main_fragment_distance_field;
 
 	main_vertex = CreateShader(GL_VERTEX_SHADER, shader_main_vertex);
 	if (!main_vertex)
@@ -274,6 +340,12 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_vertex'.");
 		return false;
 	}
+	quad_vertex = CreateShader(GL_VERTEX_SHADER, shader_quad_vertex);
+	if (!quad_vertex)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_quad_vertex'.");
+		return false;
+	}
 	main_fragment_color = CreateShader(GL_FRAGMENT_SHADER, shader_main_fragment_color);
 	if (!main_fragment_color)
 	{
@@ -286,6 +358,12 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_texture'.");
 		return false;
 	}
+	main_fragment_distance_field = CreateShader(GL_FRAGMENT_SHADER, shader_main_fragment_distance_field);
+	if (!main_fragment_distance_field)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_distance_field'.");
+		return false;
+	}
 
 	if (!CreateProgram(main_vertex, main_fragment_color, out_shaders.program_color))
 	{
@@ -297,6 +375,26 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_texture'.");
 		return false;
 	}
+	if (!CreateProgram(quad_vertex, main_fragment_color, out_shaders.program_quad_color))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_quad_color'.");
+		return false;
+	}
+	if (!CreateProgram(quad_vertex, main_fragment_texture, out_shaders.program_quad_texture))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_quad_texture'.");
+		return false;
+	}
+	if (!CreateProgram(main_vertex, main_fragment_distance_field, out_shaders.program_distance_field))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_distance_field'.");
+		return false;
+	}
+	if (!CreateProgram(quad_vertex, main_fragment_distance_field, out_shaders.program_quad_distance_field))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_quad_distance_field'.");
+		return false;
+	}
 
 	return true;
 }
@@ -305,14 +403,189 @@ static void DestroyShaders(ShadersData& shaders)
 {
 	glDeleteProgram(shaders.program_color.id);
 	glDeleteProgram(shaders.program_texture.id);
+	glDeleteProgram(shaders.program_quad_color.id);
+	glDeleteProgram(shaders.program_quad_texture.id);
+	glDeleteProgram(shaders.program_distance_field.id);
+	glDeleteProgram(shaders.program_quad_distance_field.id);
 
 	glDeleteShader(shaders.shader_main_vertex);
+	glDeleteShader(shaders.shader_quad_vertex);
 	glDeleteShader(shaders.shader_main_fragment_color);
 	glDeleteShader(shaders.shader_main_fragment_texture);
+	glDeleteShader(shaders.shader_main_fragment_distance_field);
 
 	shaders = {};
 }
 
+// Sets up the vertex attributes of the currently bound vertex array, sourced from the currently bound array buffer.
+static void SetupVertexAttributes()
+{
+	glEnableVertexAttribArray((GLuint)VertexAttribute::Position);
+	glVertexAttribPointer((GLuint)VertexAttribute::Position, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
+		(const GLvoid*)(offsetof(Rml::Vertex, position)));
+
+	glEnableVertexAttribArray((GLuint)VertexAttribute::Color0);
+	glVertexAttribPointer((GLuint)VertexAttribute::Color0, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Rml::Vertex),
+		(const GLvoid*)(offsetof(Rml::Vertex, colour)));
+
+	glEnableVertexAttribArray((GLuint)VertexAttribute::TexCoord0);
+	glVertexAttribPointer((GLuint)VertexAttribute::TexCoord0, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
+		(const GLvoid*)(offsetof(Rml::Vertex, tex_coord)));
+}
+
+// Sets up the per-instance quad attributes of the currently bound vertex array, sourced from the currently bound array buffer at the offset.
+static void SetupQuadAttributes(GLintptr offset)
+{
+	glEnableVertexAttribArray((GLuint)VertexAttribute::Rect);
+	glVertexAttribPointer((GLuint)VertexAttribute::Rect, 4, GL_FLOAT, GL_FALSE, sizeof(Rml::Quad),
+		(const GLvoid*)(offset + offsetof(Rml::Quad, top_left)));
+	glVertexAttribDivisor((GLuint)VertexAttribute::Rect, 1);
+
+	glEnableVertexAttribArray((GLuint)VertexAttribute::TexRect);
+	glVertexAttribPointer((GLuint)VertexAttribute::TexRect, 4, GL_FLOAT, GL_FALSE, sizeof(Rml::Quad),
+		(const GLvoid*)(offset + offsetof(Rml::Quad, tex_coord_top_left)));
+	glVertexAttribDivisor((GLuint)VertexAttribute::TexRect, 1);
+
+	glEnableVertexAttribArray((GLuint)VertexAttribute::Color0);
+	glVertexAttribPointer((GLuint)VertexAttribute::Color0, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Rml::Quad),
+		(const GLvoid*)(offset + offsetof(Rml::Quad, colour)));
+	glVertexAttribDivisor((GLuint)VertexAttribute::Color0, 1);
+}
+
+#ifndef RMLUI_PLATFORM_EMSCRIPTEN
+static void CreateStreamBuffer(StreamBufferData& out_stream)
+{
+	constexpr GLsizeiptr initial_vertex_capacity = 1 << 20;
+	constexpr GLsizeiptr initial_index_capacity = 1 << 18;
+
+	out_stream = {};
+	glGenVertexArrays(1, &out_stream.vao);
+	glGenVertexArrays(1, &out_stream.quad_vao);
+	glGenBuffers(1, &out_stream.vbo);
+	glGenBuffers(1, &out_stream.ibo);
+	glBindVertexArray(out_stream.vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, out_stream.vbo);
+	glBufferData(GL_ARRAY_BUFFER, initial_vertex_capacity, nullptr, GL_STREAM_DRAW);
+	SetupVertexAttributes();
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, out_stream.ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, initial_index_capacity, nullptr, GL_STREAM_DRAW);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	out_stream.vertex_capacity = initial_vertex_capacity;
+	out_stream.index_capacity = initial_index_capacity;
+
+	CheckGLError("CreateStreamBuffer");
+}
+
+static void DestroyStreamBuffer(StreamBufferData& stream)
+{
+	glDeleteVertexArrays(1, &stream.vao);
+	glDeleteVertexArrays(1, &stream.quad_vao);
+	glDeleteBuffers(1, &stream.vbo);
+	glDeleteBuffers(1, &stream.ibo);
+	stream = {};
+}
+
+// Reserves space at the aligned head of the stream buffer bound to the target, and returns its offset. The buffer is orphaned when full.
+static GLsizeiptr ReserveStreamBuffer(GLenum target, GLsizeiptr& capacity, GLsizeiptr& head, GLsizeiptr size, GLsizeiptr alignment)
+{
+	GLsizeiptr offset = (head + alignment - 1) / alignment * alignment;
+	if (offset + size > capacity)
+	{
+		// Any pending draws keep using the old storage, while the driver provides new storage for the buffer.
+		capacity = Rml::Math::Max(capacity, (GLsizeiptr)Rml::Math::ToPowerOfTwo((int)size));
+		glBufferData(target, capacity, nullptr, GL_STREAM_DRAW);
+		offset = 0;
+	}
+	head = offset + size;
+	return offset;
+}
+
+// Copies the data into the currently bound buffer at the given offset, without synchronizing with draws using earlier parts of the buffer.
+static void WriteStreamBuffer(GLenum target, GLsizeiptr offset, GLsizeiptr size, const void* data)
+{
+	void* destination = glMapBufferRange(target, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	if (destination)
+	{
+		memcpy(destination, data, (size_t)size);
+		glUnmapBuffer(target);
+	}
+}
+#endif
+
+static Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, const void* indices, int num_indices, GLenum index_type,
+	Rml::TextureHandle texture)
+{
+	constexpr GLenum draw_usage = GL_STATIC_DRAW;
+
+	GLuint vao = 0;
+	GLuint vbo = 0;
+	GLuint ibo = 0;
+
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &vbo);
+	glGenBuffers(1, &ibo);
+	glBindVertexArray(vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::Vertex) * num_vertices, (const void*)vertices, draw_usage);
+	SetupVertexAttributes();
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+	const size_t index_size = (index_type == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(int));
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_size * num_indices, indices, draw_usage);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	CheckGLError("CompileGeometry");
+
+	CompiledGeometryData* geometry = new CompiledGeometryData;
+	geometry->texture = texture;
+	geometry->vao = vao;
+	geometry->vbo = vbo;
+	geometry->ibo = ibo;
+	geometry->draw_count = num_indices;
+	geometry->index_type = index_type;
+	geometry->quads = false;
+
+	return (Rml::CompiledGeometryHandle)geometry;
+}
+
+static Rml::CompiledGeometryHandle CompileQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture)
+{
+	GLuint vao = 0;
+	GLuint vbo = 0;
+
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &vbo);
+	glBindVertexArray(vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::Quad) * num_quads, (const void*)quads, GL_STATIC_DRAW);
+	SetupQuadAttributes(0);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	CheckGLError("CompileQuads");
+
+	CompiledGeometryData* geometry = new CompiledGeometryData;
+	geometry->texture = texture;
+	geometry->vao = vao;
+	geometry->vbo = vbo;
+	geometry->ibo = 0;
+	geometry->draw_count = num_quads;
+	geometry->index_type = GL_NONE;
+	geometry->quads = true;
+
+	return (Rml::CompiledGeometryHandle)geometry;
+}
+
 } // namespace Gfx
 
 RenderInterface_GL3::RenderInterface_GL3()
@@ -321,12 +594,21 @@ RenderInterface_GL3::RenderInterface_GL3()
 
 	if (!Gfx::CreateShaders(*shaders))
 		shaders.reset();
+
+#ifndef RMLUI_PLATFORM_EMSCRIPTEN
+	stream_buffer = Rml::MakeUnique<Gfx::StreamBufferData>();
+	Gfx::CreateStreamBuffer(*stream_buffer);
+#endif
 }
 
 RenderInterface_GL3::~RenderInterface_GL3()
 {
 	if (shaders)
 		Gfx::DestroyShaders(*shaders);
+#ifndef RMLUI_PLATFORM_EMSCRIPTEN
+	if (stream_buffer)
+		Gfx::DestroyStreamBuffer(*stream_buffer);
+#endif
 }
 
 void RenderInterface_GL3::SetViewport(int width, int height)
@@ -449,6 +731,8 @@ void RenderInterface_GL3::Clear()
 void RenderInterface_GL3::RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, const Rml::TextureHandle texture,
 	const Rml::Vector2f& translation)
 {
+#ifdef RMLUI_PLATFORM_EMSCRIPTEN
+	// WebGL has neither buffer mapping nor base vertex draws, compile the geometry instead.
 	Rml::CompiledGeometryHandle geometry = CompileGeometry(vertices, num_vertices, indices, num_indices, texture);
 
 	if (geometry)
@@ -456,83 +740,166 @@ void RenderInterface_GL3::RenderGeometry(Rml::Vertex* vertices, int num_vertices
 		RenderCompiledGeometry(geometry, translation);
 		ReleaseCompiledGeometry(geometry);
 	}
+#else
+	if (!stream_buffer || num_vertices <= 0 || num_indices <= 0)
+		return;
+
+	Gfx::StreamBufferData& stream = *stream_buffer;
+	const GLsizeiptr vertices_size = GLsizeiptr(sizeof(Rml::Vertex) * num_vertices);
+	const GLsizeiptr indices_size = GLsizeiptr(sizeof(int) * num_indices);
+
+	glBindVertexArray(stream.vao);
+	glBindBuffer(GL_ARRAY_BUFFER, stream.vbo);
+
+	// Vertices are aligned to the vertex size so that they can be addressed by the base vertex, as the buffer is shared with quads.
+	const GLsizeiptr vertex_offset =
+		Gfx::ReserveStreamBuffer(GL_ARRAY_BUFFER, stream.vertex_capacity, stream.vertex_offset, vertices_size, sizeof(Rml::Vertex));
+	const GLsizeiptr index_offset =
+		Gfx::ReserveStreamBuffer(GL_ELEMENT_ARRAY_BUFFER, stream.index_capacity, stream.index_offset, indices_size, sizeof(int));
+
+	Gfx::WriteStreamBuffer(GL_ARRAY_BUFFER, vertex_offset, vertices_size, vertices);
+	Gfx::WriteStreamBuffer(GL_ELEMENT_ARRAY_BUFFER, index_offset, indices_size, indices);
+
+	const bool premultiplied = UseGeometryProgram(texture, translation, false);
+
+	const GLint base_vertex = GLint(vertex_offset / (GLsizeiptr)sizeof(Rml::Vertex));
+	glDrawElementsBaseVertex(GL_TRIANGLES, num_indices, GL_UNSIGNED_INT, (const GLvoid*)index_offset, base_vertex);
+
+	if (premultiplied)
+		ApplyBlendFunc();
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	Gfx::CheckGLError("RenderGeometry");
+#endif
 }
 
 Rml::CompiledGeometryHandle RenderInterface_GL3::CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
 	Rml::TextureHandle texture)
 {
-	constexpr GLenum draw_usage = GL_STATIC_DRAW;
+	return Gfx::CompileGeometry(vertices, num_vertices, indices, num_indices, GL_UNSIGNED_INT, texture);
+}
 
-	GLuint vao = 0;
-	GLuint vbo = 0;
-	GLuint ibo = 0;
+bool RenderInterface_GL3::Supports16BitIndices()
+{
+	return true;
+}
 
-	glGenVertexArrays(1, &vao);
-	glGenBuffers(1, &vbo);
-	glGenBuffers(1, &ibo);
-	glBindVertexArray(vao);
+Rml::CompiledGeometryHandle RenderInterface_GL3::CompileGeometryIndex16(Rml::Vertex* vertices, int num_vertices, uint16_t* indices,
+	int num_indices, Rml::TextureHandle texture)
+{
+	return Gfx::CompileGeometry(vertices, num_vertices, indices, num_indices, GL_UNSIGNED_SHORT, texture);
+}
 
-	glBindBuffer(GL_ARRAY_BUFFER, vbo);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::Vertex) * num_vertices, (const void*)vertices, draw_usage);
+bool RenderInterface_GL3::SupportsQuads()
+{
+	return true;
+}
 
-	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::Position);
-	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::Position, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
-		(const GLvoid*)(offsetof(Rml::Vertex, position)));
+void RenderInterface_GL3::RenderQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture, const Rml::Vector2f& translation)
+{
+#ifdef RMLUI_PLATFORM_EMSCRIPTEN
+	// Render the quads as vertices and indices, which are compiled on WebGL.
+	Rml::RenderInterface::RenderQuads(quads, num_quads, texture, translation);
+#else
+	if (!stream_buffer || num_quads <= 0)
+		return;
 
-	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::Color0);
-	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::Color0, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Rml::Vertex),
-		(const GLvoid*)(offsetof(Rml::Vertex, colour)));
+	Gfx::StreamBufferData& stream = *stream_buffer;
+	const GLsizeiptr quads_size = GLsizeiptr(sizeof(Rml::Quad) * num_quads);
 
-	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::TexCoord0);
-	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::TexCoord0, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
-		(const GLvoid*)(offsetof(Rml::Vertex, tex_coord)));
+	glBindVertexArray(stream.quad_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, stream.vbo);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int) * num_indices, (const void*)indices, draw_usage);
+	const GLsizeiptr quad_offset = Gfx::ReserveStreamBuffer(GL_ARRAY_BUFFER, stream.vertex_capacity, stream.vertex_offset, quads_size, 4);
+	Gfx::WriteStreamBuffer(GL_ARRAY_BUFFER, quad_offset, quads_size, quads);
+	Gfx::SetupQuadAttributes(quad_offset);
+
+	const bool premultiplied = UseGeometryProgram(texture, translation, true);
+
+	glDrawArraysInstanced(GL_TRIANGLES, 0, 6, num_quads);
+
+	if (premultiplied)
+		ApplyBlendFunc();
 
 	glBindVertexArray(0);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
 
-	Gfx::CheckGLError("CompileGeometry");
-
-	Gfx::CompiledGeometryData* geometry = new Gfx::CompiledGeometryData;
-	geometry->texture = texture;
-	geometry->vao = vao;
-	geometry->vbo = vbo;
-	geometry->ibo = ibo;
-	geometry->draw_count = num_indices;
+	Gfx::CheckGLError("RenderQuads");
+#endif
+}
 
-	return (Rml::CompiledGeometryHandle)geometry;
+Rml::CompiledGeometryHandle RenderInterface_GL3::CompileQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture)
+{
+	return Gfx::CompileQuads(quads, num_quads, texture);
 }
 
 void RenderInterface_GL3::RenderCompiledGeometry(Rml::CompiledGeometryHandle handle, const Rml::Vector2f& translation)
 {
 	Gfx::CompiledGeometryData* geometry = (Gfx::CompiledGeometryData*)handle;
 
-	if (geometry->texture)
+	const bool premultiplied = UseGeometryProgram(geometry->texture, translation, geometry->quads);
+
+	glBindVertexArray(geometry->vao);
+	if (geometry->quads)
+		glDrawArraysInstanced(GL_TRIANGLES, 0, 6, geometry->draw_count);
+	else
+		glDrawElements(GL_TRIANGLES, geometry->draw_count, geometry->index_type, (const GLvoid*)0);
+
+	if (premultiplied)
+		ApplyBlendFunc();
+
+	glBindVertexArray(0);
+	glUseProgram(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	Gfx::CheckGLError("RenderCompiledGeometry");
+}
+
+bool RenderInterface_GL3::UseGeometryProgram(Rml::TextureHandle texture, const Rml::Vector2f& translation, bool quads)
+{
+	ProgramId program_id = ProgramId::None;
+	const Gfx::ProgramData* program = nullptr;
+	auto it_distance_field = (texture ? distance_field_textures.find(texture) : distance_field_textures.end());
+	if (it_distance_field != distance_field_textures.end())
 	{
-		glUseProgram(shaders->program_texture.id);
-		if (geometry->texture != TextureEnableWithoutBinding)
-			glBindTexture(GL_TEXTURE_2D, (GLuint)geometry->texture);
-		SubmitTransformUniform(ProgramId::Texture, shaders->program_texture.uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
-		glUniform2fv(shaders->program_texture.uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
+		const DistanceFieldData& distance_field = it_distance_field->second;
+		program_id = (quads ? ProgramId::QuadDistanceField : ProgramId::DistanceField);
+		program = (quads ? &shaders->program_quad_distance_field : &shaders->program_distance_field);
+		glUseProgram(program->id);
+		glBindTexture(GL_TEXTURE_2D, distance_field.texture);
+		glUniform2f(program->uniform_locations[(size_t)Gfx::ProgramUniform::DistanceField], distance_field.edge, distance_field.softness);
+	}
+	else if (texture)
+	{
+		program_id = (quads ? ProgramId::QuadTexture : ProgramId::Texture);
+		program = (quads ? &shaders->program_quad_texture : &shaders->program_texture);
+		glUseProgram(program->id);
+		if (texture != TextureEnableWithoutBinding)
+			glBindTexture(GL_TEXTURE_2D, (GLuint)texture);
 	}
 	else
 	{
-		glUseProgram(shaders->program_color.id);
+		program_id = (quads ? ProgramId::QuadColor : ProgramId::Color);
+		program = (quads ? &shaders->program_quad_color : &shaders->program_color);
+		glUseProgram(program->id);
 		glBindTexture(GL_TEXTURE_2D, 0);
-		SubmitTransformUniform(ProgramId::Color, shaders->program_color.uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
-		glUniform2fv(shaders->program_color.uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
 	}
 
-	glBindVertexArray(geometry->vao);
-	glDrawElements(GL_TRIANGLES, geometry->draw_count, GL_UNSIGNED_INT, (const GLvoid*)0);
+	SubmitTransformUniform(program_id, program->uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
+	glUniform2fv(program->uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
 
-	glBindVertexArray(0);
-	glUseProgram(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	// Render targets contain premultiplied alpha.
+	const bool premultiplied = (texture && render_targets.find(texture) != render_targets.end());
+	if (premultiplied)
+		glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
-	Gfx::CheckGLError("RenderCompiledGeometry");
+	return premultiplied;
 }
 
 void RenderInterface_GL3::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle handle)
@@ -548,6 +915,8 @@ void RenderInterface_GL3::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle ha
 
 void RenderInterface_GL3::EnableScissorRegion(bool enable)
 {
+	scissor_enabled = enable;
+
 	ScissoringState new_state = ScissoringState::Disable;
 
 	if (enable)
@@ -573,6 +942,8 @@ void RenderInterface_GL3::EnableScissorRegion(bool enable)
 
 void RenderInterface_GL3::SetScissorRegion(int x, int y, int width, int height)
 {
+	scissor_region = Rml::Rectanglei::FromPositionSize({x, y}, {width, height});
+
 	if (transform_active)
 	{
 		const float left = float(x);
@@ -599,6 +970,12 @@ void RenderInterface_GL3::SetScissorRegion(int x, int y, int width, int height)
 		glStencilFunc(GL_EQUAL, 1, GLuint(-1));
 		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 	}
+	else if (!render_target_stack.empty())
+	{
+		// Render targets are rendered upside-down so that they can be sampled top-down, and are offset by their region.
+		const Rml::Rectanglei& region = render_target_stack.back().region;
+		glScissor(x - region.Left(), y - region.Top(), width, height);
+	}
 	else
 	{
 		glScissor(x, viewport_height - (y + height), width, height);
@@ -741,18 +1118,178 @@ bool RenderInterface_GL3::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Rectanglei& region)
+{
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region.Left(), region.Top(), region.Width(), region.Height(), GL_RGBA, GL_UNSIGNED_BYTE, source);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return true;
+}
+
+bool RenderInterface_GL3::SupportsDistanceFieldTextures()
+{
+	return true;
+}
+
+Rml::TextureHandle RenderInterface_GL3::CreateDistanceFieldTexture(Rml::TextureHandle texture_handle, float edge, float softness)
+{
+	// Distance field handles count down from the largest handles, so that they do not collide with texture names.
+	const Rml::TextureHandle distance_field_handle = next_distance_field_texture--;
+	distance_field_textures[distance_field_handle] = DistanceFieldData{(unsigned int)texture_handle, edge, softness};
+	return distance_field_handle;
+}
+
 void RenderInterface_GL3::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
+	// Distance field handles only refer to another texture.
+	if (distance_field_textures.erase(texture_handle))
+		return;
+
+	auto it = render_targets.find(texture_handle);
+	if (it != render_targets.end())
+	{
+		glDeleteFramebuffers(1, &it->second.framebuffer);
+		glDeleteRenderbuffers(1, &it->second.stencil_buffer);
+		render_targets.erase(it);
+	}
+
 	glDeleteTextures(1, (GLuint*)&texture_handle);
 }
 
 void RenderInterface_GL3::SetTransform(const Rml::Matrix4f* new_transform)
 {
 	transform_active = (new_transform != nullptr);
-	transform = projection * (new_transform ? *new_transform : Rml::Matrix4f::Identity());
+	local_transform = (new_transform ? *new_transform : Rml::Matrix4f::Identity());
+	transform = projection * local_transform;
 	transform_dirty_state = ProgramId::All;
 }
 
+Rml::TextureHandle RenderInterface_GL3::CreateRenderTarget(const Rml::Vector2i& dimensions)
+{
+	GLuint texture_id = 0;
+	glGenTextures(1, &texture_id);
+	if (texture_id == 0)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Failed to generate render target texture.");
+		return 0;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture_id);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, dimensions.x, dimensions.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	// The stencil buffer is needed for scissoring with transforms.
+	GLuint stencil_buffer = 0;
+	glGenRenderbuffers(1, &stencil_buffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, stencil_buffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, dimensions.x, dimensions.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	GLint previous_framebuffer = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+
+	GLuint framebuffer = 0;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_id, 0);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, stencil_buffer);
+	const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)previous_framebuffer);
+
+	Gfx::CheckGLError("CreateRenderTarget");
+
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Failed to create render target framebuffer, status: %d", (int)status);
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteRenderbuffers(1, &stencil_buffer);
+		glDeleteTextures(1, &texture_id);
+		return 0;
+	}
+
+	const Rml::TextureHandle texture_handle = (Rml::TextureHandle)texture_id;
+	render_targets[texture_handle] = RenderTargetData{framebuffer, stencil_buffer};
+
+	return texture_handle;
+}
+
+void RenderInterface_GL3::PushRenderTarget(Rml::TextureHandle render_target, const Rml::Rectanglei& region)
+{
+	auto it = render_targets.find(render_target);
+	RMLUI_ASSERT(it != render_targets.end());
+	if (it == render_targets.end())
+		return;
+
+	RenderTargetState state;
+	state.region = region;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &state.previous_framebuffer);
+	glGetIntegerv(GL_VIEWPORT, state.previous_viewport);
+	state.previous_projection = projection;
+	state.previous_transform_active = transform_active;
+	state.previous_transform = local_transform;
+	state.previous_scissor_enabled = scissor_enabled;
+	state.previous_scissor_region = scissor_region;
+	render_target_stack.push_back(state);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, it->second.framebuffer);
+	glViewport(0, 0, region.Width(), region.Height());
+
+	// Clear the whole render target, thus scissoring is temporarily disabled.
+	if (scissoring_state == ScissoringState::Scissor)
+		glDisable(GL_SCISSOR_TEST);
+	glClearColor(0, 0, 0, 0);
+	glClearStencil(0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+	glClearColor(0, 0, 0, 1);
+	if (scissoring_state == ScissoringState::Scissor)
+		glEnable(GL_SCISSOR_TEST);
+
+	// Flip the projection vertically, so that the first row of the texture corresponds to the top of the region.
+	projection = Rml::Matrix4f::ProjectOrtho((float)region.Left(), (float)region.Right(), (float)region.Top(), (float)region.Bottom(), -10000, 10000);
+	ApplyBlendFunc();
+
+	// Apply the current transform and scissor region to the render target.
+	SetTransform(transform_active ? &state.previous_transform : nullptr);
+	if (scissor_enabled)
+		SetScissorRegion(scissor_region.Left(), scissor_region.Top(), scissor_region.Width(), scissor_region.Height());
+}
+
+void RenderInterface_GL3::PopRenderTarget()
+{
+	if (render_target_stack.empty())
+		return;
+
+	const RenderTargetState state = render_target_stack.back();
+	render_target_stack.pop_back();
+
+	glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)state.previous_framebuffer);
+	glViewport(state.previous_viewport[0], state.previous_viewport[1], state.previous_viewport[2], state.previous_viewport[3]);
+	projection = state.previous_projection;
+	ApplyBlendFunc();
+
+	// Restore the state which was active when the render target was pushed.
+	SetTransform(state.previous_transform_active ? &state.previous_transform : nullptr);
+	EnableScissorRegion(state.previous_scissor_enabled);
+	if (state.previous_scissor_enabled)
+	{
+		const Rml::Rectanglei& region = state.previous_scissor_region;
+		SetScissorRegion(region.Left(), region.Top(), region.Width(), region.Height());
+	}
+}
+
+void RenderInterface_GL3::ApplyBlendFunc()
+{
+	if (render_target_stack.empty())
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	else
+		glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
 void RenderInterface_GL3::SubmitTransformUniform(ProgramId program_id, int uniform_location)
 {
 	if ((int)program_id & (int)transform_dirty_state)
@@ -34,6 +34,7 @@
 
 namespace Gfx {
 struct ShadersData;
+struct StreamBufferData;
 }
 
 class RenderInterface_GL3 : public Rml::RenderInterface {
@@ -61,6 +62,12 @@ public:
 
 	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
 		Rml::TextureHandle texture) override;
+	bool Supports16BitIndices() override;
+	Rml::CompiledGeometryHandle CompileGeometryIndex16(Rml::Vertex* vertices, int num_vertices, uint16_t* indices, int num_indices,
+		Rml::TextureHandle texture) override;
+	bool SupportsQuads() override;
+	void RenderQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture, const Rml::Vector2f& translation) override;
+	Rml::CompiledGeometryHandle CompileQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture) override;
 	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
 	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
 
@@ -69,28 +76,89 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Rectanglei& region) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
+	bool SupportsDistanceFieldTextures() override;
+	Rml::TextureHandle CreateDistanceFieldTexture(Rml::TextureHandle texture_handle, float edge, float softness) override;
+
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	Rml::TextureHandle CreateRenderTarget(const Rml::Vector2i& dimensions) override;
+	void PushRenderTarget(Rml::TextureHandle render_target, const Rml::Rectanglei& region) override;
+	void PopRenderTarget() override;
+
 	// Can be passed to RenderGeometry() to enable texture rendering without changing the bound texture.
 	static const Rml::TextureHandle TextureEnableWithoutBinding = Rml::TextureHandle(-1);
 
 private:
-	enum class ProgramId { None, Texture = 1, Color = 2, All = (Texture | Color) };
+	enum class ProgramId {
+		None,
+		Texture = 1,
+		Color = 2,
+		QuadTexture = 4,
+		QuadColor = 8,
+		DistanceField = 16,
+		QuadDistanceField = 32,
+		All = (Texture | Color | QuadTexture | QuadColor | DistanceField | QuadDistanceField)
+	};
 	void SubmitTransformUniform(ProgramId program_id, int uniform_location);
+	// Binds the program and texture for rendering geometry, or instanced quads. Returns true if the blend function was changed for
+	// premultiplied alpha, in which case it should be restored with ApplyBlendFunc() after drawing.
+	bool UseGeometryProgram(Rml::TextureHandle texture, const Rml::Vector2f& translation, bool quads);
+	// Sets the blend function for the current render target, render targets store premultiplied alpha.
+	void ApplyBlendFunc();
 
 	Rml::Matrix4f transform, projection;
 	ProgramId transform_dirty_state = ProgramId::All;
 	bool transform_active = false;
+	// The last transform submitted by RmlUi, without the projection.
+	Rml::Matrix4f local_transform = Rml::Matrix4f::Identity();
 
 	enum class ScissoringState { Disable, Scissor, Stencil };
 	ScissoringState scissoring_state = ScissoringState::Disable;
+	// The last scissor state submitted by RmlUi, in context coordinates.
+	bool scissor_enabled = false;
+	Rml::Rectanglei scissor_region;
+
+	struct RenderTargetData {
+		unsigned int framebuffer;
+		unsigned int stencil_buffer;
+	};
+	// Render targets by their texture handle.
+	Rml::UnorderedMap<Rml::TextureHandle, RenderTargetData> render_targets;
+
+	struct DistanceFieldData {
+		unsigned int texture;
+		float edge;
+		float softness;
+	};
+	// Textures rendered as distance fields by their handle.
+	Rml::UnorderedMap<Rml::TextureHandle, DistanceFieldData> distance_field_textures;
+	// Skip the largest handle, reserved for TextureEnableWithoutBinding.
+	Rml::TextureHandle next_distance_field_texture = Rml::TextureHandle(-2);
+
+	// The state to restore when a render target is popped.
+	struct RenderTargetState {
+		Rml::Rectanglei region;
+		int previous_framebuffer;
+		int previous_viewport[4];
+		Rml::Matrix4f previous_projection;
+		bool previous_transform_active;
+		Rml::Matrix4f previous_transform;
+		bool previous_scissor_enabled;
+		Rml::Rectanglei previous_scissor_region;
+	};
+	Rml::Vector<RenderTargetState> render_target_stack;
 
 	int viewport_width = 0;
 	int viewport_height = 0;
 
 	Rml::UniquePtr<Gfx::ShadersData> shaders;
+#ifndef RMLUI_PLATFORM_EMSCRIPTEN
+	// Not available on WebGL, where immediate geometry is compiled instead.
+	Rml::UniquePtr<Gfx::StreamBufferData> stream_buffer;
+#endif
 
 	struct GLStateBackup {
 		bool enable_cull_face;
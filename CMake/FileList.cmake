@@ -1,6 +1,8 @@
 # This file was auto-generated with gen_filelists.sh
 
 set(Core_HDR_FILES
+    ${PROJECT_SOURCE_DIR}/Source/Core/AncestorFilter.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/AtomTable.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Clock.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ComputeProperty.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ContextInstancerDefault.h
@@ -28,6 +30,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementDecoration.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementDefinition.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementHandle.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementLayer.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Elements/ElementImage.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Elements/ElementLabel.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Elements/ElementTextSelection.h
@@ -70,6 +73,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/InlineLevelBox.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/InlineTypes.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutBox.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutCache.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutDetails.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutEngine.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutPools.h
@@ -92,14 +96,18 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserString.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserTransform.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyShorthandDefinition.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/RenderCommandList.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/RmlNodeTree.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ScrollController.h
     ${PROJECT_SOURCE_DIR}/Source/Core/StreamFile.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/StyleSharingCache.h
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetFactory.h
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetNode.h
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetParser.h
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetSelector.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Template.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TemplateCache.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/TextureAtlas.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureDatabase.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayout.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayoutRectangle.h
@@ -190,6 +198,7 @@ set(Core_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/PropertyIdSet.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/PropertyParser.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/PropertySpecification.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Quad.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Rectangle.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/RenderInterface.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ScriptInterface.h
@@ -204,6 +213,7 @@ set(Core_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/StyleSheetTypes.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/StyleTypes.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/SystemInterface.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/TaskInterface.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Texture.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Traits.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Transform.h
@@ -229,6 +239,8 @@ set(Core_PUB_HDR_FILES
 )
 
 set(Core_SRC_FILES
+    ${PROJECT_SOURCE_DIR}/Source/Core/AncestorFilter.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/AtomTable.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/BaseXMLParser.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Box.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Clock.cpp
@@ -271,6 +283,7 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementDocument.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementHandle.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementInstancer.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementLayer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Elements/ElementForm.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Elements/ElementFormControl.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Elements/ElementFormControlInput.cpp
@@ -331,6 +344,7 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/InlineContainer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/InlineLevelBox.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutBox.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutDetails.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutEngine.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Layout/LayoutPools.cpp
@@ -359,13 +373,16 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserString.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserTransform.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertySpecification.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/RenderCommandList.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/RenderInterface.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/RmlNodeTree.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ScrollController.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Spritesheet.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Stream.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StreamFile.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StreamMemory.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StringUtilities.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/StyleSharingCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheet.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetContainer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetFactory.cpp
@@ -374,9 +391,11 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetSelector.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetSpecification.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/SystemInterface.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/TaskInterface.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Template.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TemplateCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Texture.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/TextureAtlas.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureDatabase.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayout.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayoutRectangle.cpp
@@ -438,11 +457,13 @@ set(Debugger_SRC_FILES
 if(NOT NO_FONT_INTERFACE_DEFAULT)
     set(Core_HDR_FILES
         ${Core_HDR_FILES}
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontDistanceField.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontEngineInterfaceDefault.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFace.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFaceHandleDefault.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFaceLayer.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFamily.h
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontGlyphCache.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontProvider.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontTypes.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FreeTypeInterface.h
@@ -450,11 +471,13 @@ if(NOT NO_FONT_INTERFACE_DEFAULT)
 
     set(Core_SRC_FILES
         ${Core_SRC_FILES}
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontDistanceField.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontEngineInterfaceDefault.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFace.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFaceHandleDefault.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFaceLayer.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFamily.cpp
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontGlyphCache.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontProvider.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FreeTypeInterface.cpp
     )
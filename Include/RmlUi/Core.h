@@ -74,6 +74,7 @@
 #include "Core/PropertyIdSet.h"
 #include "Core/PropertyParser.h"
 #include "Core/PropertySpecification.h"
+#include "Core/Quad.h"
 #include "Core/RenderInterface.h"
 #include "Core/Spritesheet.h"
 #include "Core/StringUtilities.h"
@@ -82,6 +83,7 @@
 #include "Core/StyleSheetSpecification.h"
 #include "Core/StyleTypes.h"
 #include "Core/SystemInterface.h"
+#include "Core/TaskInterface.h"
 #include "Core/Texture.h"
 #include "Core/Transform.h"
 #include "Core/TransformPrimitive.h"
@@ -157,7 +157,8 @@ namespace Style {
 
 			flex_basis_type(LengthPercentageAuto::Auto), row_gap_type(LengthPercentage::Length), column_gap_type(LengthPercentage::Length),
 
-			vertical_align_type(VerticalAlign::Baseline), drag(Drag::None), tab_index(TabIndex::None), overscroll_behavior(OverscrollBehavior::Auto)
+			vertical_align_type(VerticalAlign::Baseline), drag(Drag::None), tab_index(TabIndex::None), overscroll_behavior(OverscrollBehavior::Auto),
+			layer(Layer::Auto)
 		{}
 
 		LengthPercentage::Type min_width_type : 1, max_width_type : 1;
@@ -174,6 +175,7 @@ namespace Style {
 		Drag drag : 3;
 		TabIndex tab_index : 1;
 		OverscrollBehavior overscroll_behavior : 1;
+		Layer layer : 1;
 
 		Clip clip;
 
@@ -295,6 +297,7 @@ namespace Style {
 		LengthPercentage  row_gap()                    const { return LengthPercentage(rare.row_gap_type, rare.row_gap); }
 		LengthPercentage  column_gap()                 const { return LengthPercentage(rare.column_gap_type, rare.column_gap); }
 		OverscrollBehavior overscroll_behavior()       const { return rare.overscroll_behavior; }
+		Layer             layer()                      const { return rare.layer; }
 		float             scrollbar_margin()           const { return rare.scrollbar_margin; }
 		
 		// -- Assignment --
@@ -375,6 +378,7 @@ namespace Style {
 		void tab_index                 (TabIndex value)          { rare.tab_index                  = value; }
 		void image_color               (Colourb value)           { rare.image_color                = value; }
 		void overscroll_behavior       (OverscrollBehavior value){ rare.overscroll_behavior        = value; }
+		void layer                     (Layer value)             { rare.layer                      = value; }
 		void scrollbar_margin          (float value)             { rare.scrollbar_margin           = value; }
 
 		// clang-format on
@@ -46,6 +46,8 @@ class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
 class ScrollController;
+class RenderCommandList;
+class RenderInterface;
 enum class EventId : uint16_t;
 
 /**
@@ -86,6 +88,28 @@ public:
 	bool Update();
 	/// Renders all visible elements in the context's documents.
 	bool Render();
+	/// Returns the render interface that custom elements and decorators should render through while the context is rendered. When the
+	/// context's render calls are being recorded, such as for batching or dirty regions, this is a recorder in front of the application's
+	/// render interface, otherwise it is the application's render interface itself.
+	RenderInterface* GetRenderInterface() const;
+
+	/// Returns true if the rendered output of the context may have changed since it was last rendered. This includes any changes
+	/// to properties, layout, scrolling, and the element hierarchy, and should be queried after calling Update(). As long as this
+	/// returns false, the application may skip Render() and present its previous frame instead.
+	bool IsRenderDirty() const;
+	/// Marks the rendered output of the whole context as changed. Changes to properties, layout, and the element hierarchy are
+	/// detected automatically, see also Element::DirtyRender() to only mark a single element as changed.
+	void DirtyRender();
+
+	/// Enables tracking of the regions of the context which change between renders, see GetDirtyRegions().
+	/// @param[in] enable True to track dirty regions.
+	/// @param[in] restrict_render True to restrict Render() to the dirty regions, leaving the rest of the previous frame untouched.
+	void EnableDirtyRegions(bool enable, bool restrict_render = false);
+	/// Returns the regions of the context which changed since the last call to Render(), in pixels. The regions do not overlap.
+	/// This records the render commands of the context, which are then submitted by the next call to Render(). Thus, it should be
+	/// called after Update(), and the regions can be prepared for rendering, such as by clearing them, before calling Render().
+	/// @return The dirty regions, or an empty list if dirty region tracking is disabled.
+	const Vector<Rectanglei>& GetDirtyRegions();
 
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
@@ -381,6 +405,21 @@ private:
 	// See RequestNextUpdate() and NextUpdateRequested() for details.
 	double next_update_timeout;
 
+	// True if the rendered output may have changed since the last call to Render().
+	bool render_dirty = true;
+
+	// Dirty region tracking, see EnableDirtyRegions().
+	bool dirty_regions_enabled = false;
+	bool dirty_regions_restrict_render = false;
+	// Regions changed since the last submitted frame, or of the last submitted frame until a new change is made.
+	Vector<Rectanglei> dirty_regions;
+	bool dirty_regions_submitted = false;
+	// True if the render commands have been recorded but not yet submitted.
+	bool render_commands_pending = false;
+
+	// Retained list of render commands, only used when batching is enabled by the render interface.
+	UniquePtr<RenderCommandList> render_commands;
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -416,6 +455,17 @@ private:
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
+	// Renders the root element and any drag clone.
+	void RenderElements();
+	// Records the render commands of the context, along with its dirty regions.
+	void RecordRender(RenderInterface* render_interface);
+	// Records the render commands again if the rendered output may have changed, otherwise keeps the previous commands for replaying them.
+	void UpdateRenderCommands(RenderInterface* render_interface);
+	// Adds the given screen-space rectangle to the dirty regions, if enabled.
+	void AddDirtyRegion(Rectanglef region);
+	// Joins overlapping dirty regions.
+	void MergeDirtyRegions();
+
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
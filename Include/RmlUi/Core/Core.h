@@ -42,6 +42,7 @@ class FileInterface;
 class FontEngineInterface;
 class RenderInterface;
 class SystemInterface;
+class TaskInterface;
 enum class DefaultActionPhase;
 
 /**
@@ -89,6 +90,14 @@ RMLUICORE_API void SetFontEngineInterface(FontEngineInterface* font_interface);
 /// Returns RmlUi's font interface.
 RMLUICORE_API FontEngineInterface* GetFontEngineInterface();
 
+/// Sets the interface through which tasks are run in parallel. This is not required to be called, but if it is it must be
+/// called before Initialise().
+/// @param[in] task_interface A non-owning pointer to the application-specified task interface.
+/// @lifetime The interface must be kept alive until after the call to Rml::Shutdown.
+RMLUICORE_API void SetTaskInterface(TaskInterface* task_interface);
+/// Returns RmlUi's task interface.
+RMLUICORE_API TaskInterface* GetTaskInterface();
+
 /// Creates a new element context.
 /// @param[in] name The new name of the context. This must be unique.
 /// @param[in] dimensions The initial dimensions of the new context.
@@ -148,6 +157,13 @@ RMLUICORE_API EventId RegisterEventType(const String& type, bool interruptible,
 
 /// Returns a list of source URLs to textures in all loaded documents.
 RMLUICORE_API StringList GetTextureSourceList();
+/// Enables packing of images loaded from file into shared texture atlas pages, so that elements using different images can be rendered together.
+/// Atlas pages are render targets, thus this requires a render interface supporting render targets.
+/// @param[in] max_image_size Images with a width or height larger than this are not packed. Zero disables the texture atlas.
+/// @param[in] page_size The width and height of each atlas page.
+/// @note Only affects textures loaded after this call, and should be called before loading any documents.
+/// @note The areas of packed images are reused once their textures are released and no longer used by any element.
+RMLUICORE_API void EnableTextureAtlas(int max_image_size, int page_size = 1024);
 /// Forces all texture handles loaded and generated by RmlUi to be released.
 RMLUICORE_API void ReleaseTextures();
 /// Releases a specified texture by name from memory, returning 'true' if successful and 'false' if not found.
@@ -158,7 +174,26 @@ RMLUICORE_API void ReleaseCompiledGeometry();
 /// @note Invalidates all existing FontFaceHandles returned from the font engine.
 RMLUICORE_API void ReleaseFontResources();
 
-/// Forces all memory pools used by RmlUi to be released.
+/// Statistics of the memory used for the vertices and indices of geometry, see GetGeometryMemoryStats().
+struct GeometryMemoryStats {
+	/// Number of allocated pages of geometry slots.
+	int num_pages = 0;
+	/// Number of slots in use by geometry.
+	int num_geometry = 0;
+	/// Number of slots available for new geometry.
+	int num_free_slots = 0;
+	/// Size of the vertex and index data in use, in bytes.
+	size_t used_bytes = 0;
+	/// Size of the memory reserved by all buffers, in bytes.
+	size_t reserved_bytes = 0;
+
+	/// Returns the fraction of reserved memory which is not in use, from free slots and excess capacity.
+	float GetFragmentation() const { return reserved_bytes == 0 ? 0.f : 1.f - float(used_bytes) / float(reserved_bytes); }
+};
+/// Returns statistics of the memory used for the vertices and indices of geometry, such as to decide when to call ReleaseMemoryPools().
+RMLUICORE_API GeometryMemoryStats GetGeometryMemoryStats();
+
+/// Forces all memory pools used by RmlUi to be released. This includes memory reserved for the vertices and indices of geometry no longer in use.
 RMLUICORE_API void ReleaseMemoryPools();
 
 } // namespace Rml
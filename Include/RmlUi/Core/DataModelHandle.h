@@ -40,6 +40,22 @@ namespace Rml {
 
 class DataModel;
 
+// Refers to a top-level variable of a data model, see DataModelHandle::GetVariableHandle().
+class DataVariableHandle {
+public:
+	DataVariableHandle() = default;
+
+	explicit operator bool() const { return model && variable_id >= 0; }
+
+private:
+	DataVariableHandle(const DataModel* model, int variable_id) : model(model), variable_id(variable_id) {}
+
+	const DataModel* model = nullptr;
+	int variable_id = -1;
+
+	friend class DataModelHandle;
+};
+
 class RMLUICORE_API DataModelHandle {
 public:
 	DataModelHandle(DataModel* model = nullptr);
@@ -48,6 +64,12 @@ public:
 	void DirtyVariable(const String& variable_name);
 	void DirtyAllVariables();
 
+	// Returns a handle to the given variable, which can be dirtied without looking up its name. Only valid for this data model, the handle
+	// evaluates to false if no variable by this name has been bound.
+	DataVariableHandle GetVariableHandle(const String& variable_name);
+	bool IsVariableDirty(DataVariableHandle variable);
+	void DirtyVariable(DataVariableHandle variable);
+
 	explicit operator bool() { return model; }
 
 private:
@@ -46,6 +46,7 @@ namespace Rml {
 
 class Context;
 class DataModel;
+class DataViewFor;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
@@ -56,6 +57,7 @@ class ElementDocument;
 class ElementScroll;
 class ElementStyle;
 class ContainerBox;
+class FormattingContext;
 class InlineLevelBox;
 class ReplacedBox;
 class PropertiesIteratorView;
@@ -64,6 +66,7 @@ class StyleSheet;
 class StyleSheetContainer;
 class TransformState;
 struct ElementMeta;
+struct LayoutCache;
 struct StackingContextChild;
 
 /**
@@ -596,6 +599,11 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+	/// Marks the rendered output of this element as changed, this includes the element in the dirty regions of its context.
+	/// Changes to properties, attributes, and layout are detected automatically, this is only needed by custom elements
+	/// which change their geometry by other means.
+	void DirtyRender();
+
 protected:
 	void Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
@@ -677,6 +685,27 @@ private:
 	void AddToStackingContext(Vector<StackingContextChild>& stacking_children, bool is_flex_item, bool is_non_dom_element);
 	void DirtyStackingContext();
 
+	// Returns the clipping region of this element during the current render pass, or an invalid rectangle if the element is not clipped.
+	Rectanglei GetRenderClip();
+	// Returns the clipping region applied to elements offset from this element, computed at most once per render pass.
+	Rectanglei GetRenderClipForOffsetChildren();
+	// Returns true if the border boxes of this element, after transform, lie completely outside the given clipping region.
+	bool IsOutsideRenderClip(Rectanglei clip);
+	// Invalidates the clipping regions cached during the previous render pass.
+	static void BeginRenderPass();
+
+	// Adds the previous and new render region of this element to the dirty regions of the context if they differ, or if the element changed.
+	void UpdateRenderRegion(Context* context, Rectanglef region);
+	// Adds the render region of this element, and optionally its descendants, to the dirty regions of the context, and clears them.
+	void ReleaseRenderRegion(Context* context, bool recursive);
+
+	// Renders this element and its stacking context through its cached layer, returns false if the layer cannot be used.
+	bool RenderLayer(Context* context, Rectanglei clip);
+	// Marks the cached layers of this element and its ancestors as changed.
+	void DirtyLayer();
+
+	// Dirty the definitions of only those elements that may be affected by toggling the given class or pseudo class on this element.
+	void DirtyDefinitionOnToggle(Atom name, bool is_pseudo_class);
 	void UpdateDefinition();
 
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
@@ -685,6 +714,10 @@ private:
 	void OnDpRatioChangeRecursive();
 	void DirtyFontFaceRecursive();
 
+	/// Moves the given children so that they occupy their current set of positions in the given order. The children are not detached during the
+	/// move, thus their data bindings and other state are retained.
+	void ReorderChildren(const ElementList& ordered_children);
+
 	/// Start an animation, replacing any existing animations of the same property name. If start_value is null, the element's current value is used.
 	ElementAnimationList::iterator StartAnimation(PropertyId property_id, const Property* start_value, int num_iterations, bool alternate_direction,
 		float delay, bool initiated_by_animation_property);
@@ -717,14 +750,21 @@ private:
 	bool offset_fixed;
 	bool absolute_offset_dirty;
 
-	bool dirty_definition : 1; // Implies dirty child definitions as well.
-	bool dirty_child_definitions : 1;
+	bool dirty_definition : 1;
+	bool dirty_child_definitions : 1; // Implies dirty definitions of all descendants.
 
 	bool dirty_animation : 1;
 	bool dirty_transition : 1;
 	bool dirty_transform : 1;
 	bool dirty_perspective : 1;
 
+	bool layout_boundary : 1; // True if changes within the element could not affect the layout outside it, as of its last formatting.
+
+	// True if no element in our local stacking context can escape the clipping region of our offset children, or our border box.
+	bool stacking_context_clip_contained : 1;
+	// True if the rendered output of the element changed since its render region was last updated.
+	bool render_region_dirty : 1;
+
 	OwnedElementList children;
 	int num_non_dom_children;
 
@@ -774,6 +814,12 @@ private:
 	// And of the element's scrollable content.
 	Vector2f scrollable_overflow_rectangle;
 
+	// The containing block used during the last formatting, only valid for layout boundaries.
+	Vector2f layout_boundary_containing_block;
+
+	// The result of the last independent formatting of the element, if any.
+	UniquePtr<LayoutCache> layout_cache;
+
 	float baseline;
 	float z_index;
 
@@ -788,6 +834,8 @@ private:
 	friend class Rml::Context;
 	friend class Rml::ElementStyle;
 	friend class Rml::ContainerBox;
+	friend class Rml::DataViewFor;
+	friend class Rml::FormattingContext;
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
 	friend class Rml::ElementScroll;
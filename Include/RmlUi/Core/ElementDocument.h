@@ -161,6 +161,8 @@ private:
 	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Marks the given layout boundary as needing a re-layout, without formatting the rest of the document.
+	void DirtyLayoutBoundary(Element* layout_boundary);
 
 	/// Notify the document that media query related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -192,10 +194,13 @@ private:
 
 	// Is the layout dirty?
 	bool layout_dirty;
+	// Layout boundaries that need to be formatted, when the layout of the whole document is not dirty.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
 
 	bool position_dirty;
 
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 };
 
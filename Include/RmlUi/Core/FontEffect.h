@@ -59,6 +59,7 @@ public:
 	virtual bool GetGlyphMetrics(Vector2i& origin, Vector2i& dimensions, const FontGlyph& glyph) const;
 
 	/// Requests the effect to generate the texture data for a single glyph's bitmap. The default implementation does nothing.
+	/// @note This may be called concurrently for different glyphs from multiple threads, see Rml::SetTaskInterface().
 	/// @param[out] destination_data The top-left corner of the glyph's 32-bit, RGBA-ordered, destination texture. Note that the glyph shares its
 	/// texture with other glyphs.
 	/// @param[in] destination_dimensions The dimensions of the glyph's area on its texture.
@@ -66,6 +67,14 @@ public:
 	/// @param[in] glyph The glyph the effect is being asked to generate an effect texture for.
 	virtual void GenerateGlyphTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride, const FontGlyph& glyph) const;
 
+	/// Requests the parameters for rendering the effect directly from the glyph's signed distance field, used instead of the effect's
+	/// textures with distance field fonts. The default implementation returns false.
+	/// @param[out] width The distance, in pixels, by which the effect grows the outline of the glyph.
+	/// @param[out] softness The distance, in pixels, over which the edge of the effect fades out on each side of its outline.
+	/// @param[out] offset The offset, in pixels, of the effect from the glyph.
+	/// @return True if the effect can be rendered from a distance field, false if it is not rendered with distance field fonts.
+	virtual bool GetDistanceFieldParameters(float& width, float& softness, Vector2i& offset) const;
+
 	/// Sets the colour of the effect's geometry.
 	void SetColour(Colourb colour);
 	/// Returns the effect's colour.
@@ -36,6 +36,18 @@
 
 namespace Rml {
 
+/**
+    Statistics of the glyphs rendered by a font engine, and the textures storing them.
+ */
+struct FontGlyphCacheStatistics {
+	// The number of glyphs resident in all font face handles.
+	int num_glyphs = 0;
+	// The number of textures holding rendered glyphs, including those of font effects.
+	int num_textures = 0;
+	// The total size of these textures, in bytes.
+	size_t texture_bytes = 0;
+};
+
 /**
     The abstract base class for an application-specific font engine implementation.
 
@@ -118,6 +130,23 @@ public:
 	/// Called by RmlUi when it wants to garbage collect memory used by fonts.
 	/// @note All existing FontFaceHandles and FontEffectsHandles are considered invalid after this call.
 	virtual void ReleaseFontResources();
+
+	/// Called by RmlUi when it wants to limit the memory used by the textures of rendered glyphs.
+	/// @param[in] budget_bytes The maximum size of all glyph textures in bytes, or zero for no limit.
+	virtual void SetGlyphCacheBudget(size_t budget_bytes);
+	/// Called by RmlUi at the start of each context update, to evict glyphs which have not been used recently when over budget. With multiple
+	/// contexts this is called several times per frame, so nothing should be done unless glyphs were used since the last call.
+	/// @return True if any glyphs were evicted, in which case the version of their font face handles must have changed.
+	virtual bool TrimGlyphCache();
+	/// Called by RmlUi when it wants to retrieve statistics of the glyph cache.
+	/// @return The number of resident glyphs and the number and size of their textures.
+	virtual FontGlyphCacheStatistics GetGlyphCacheStatistics();
+
+	/// Called by RmlUi when it wants to render text from signed distance fields, if supported by the render interface. Then all sizes of a
+	/// font face can be rendered from the same glyph textures, and font effects are rendered from them instead of their own textures.
+	/// @param[in] enable True to render font face handles created from now on from distance fields, false to render them from bitmaps.
+	/// @note Call Rml::ReleaseFontResources() afterwards to apply the change to existing text.
+	virtual void SetDistanceFieldFonts(bool enable);
 };
 
 } // namespace Rml
@@ -86,8 +86,9 @@ private:
 	// Move members from another geometry.
 	void MoveFrom(Geometry& other) noexcept;
 
-	Vector<Vertex> vertices;
-	Vector<int> indices;
+	// The vertex and index buffers are owned by the geometry database, which reuses them for new geometry after this is destroyed.
+	Vector<Vertex>* vertices = nullptr;
+	Vector<int>* indices = nullptr;
 	const Texture* texture = nullptr;
 
 	CompiledGeometryHandle compiled_geometry = 0;
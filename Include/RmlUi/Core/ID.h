@@ -139,6 +139,7 @@ enum class PropertyId : uint8_t {
 	TabIndex,
 	ScrollbarMargin,
 	OverscrollBehavior,
+	Layer,
 
 	Perspective,
 	PerspectiveOriginX,
@@ -0,0 +1,56 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_QUAD_H
+#define RMLUI_CORE_QUAD_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    An axis-aligned rectangle with a single colour, such as a text glyph or an image, sent to the renderer as a compact alternative to its
+    four vertices and six indices.
+ */
+
+struct RMLUICORE_API Quad {
+	/// Position of the top-left corner (usually in pixels).
+	Vector2f top_left;
+	/// Position of the bottom-right corner (usually in pixels).
+	Vector2f bottom_right;
+	/// Texture coordinate at the top-left corner.
+	Vector2f tex_coord_top_left;
+	/// Texture coordinate at the bottom-right corner.
+	Vector2f tex_coord_bottom_right;
+	/// RGBA-ordered 8-bit / channel colour, shared by all corners.
+	Colourb colour;
+};
+
+} // namespace Rml
+#endif
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_RENDERINTERFACE_H
 
 #include "Header.h"
+#include "Quad.h"
 #include "Texture.h"
 #include "Traits.h"
 #include "Types.h"
@@ -71,6 +72,38 @@ public:
 	/// @return The application-specific compiled geometry. Compiled geometry will be stored and rendered using RenderCompiledGeometry() in future
 	/// calls, and released with ReleaseCompiledGeometry() when it is no longer needed.
 	virtual CompiledGeometryHandle CompileGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, TextureHandle texture);
+	/// Called by RmlUi to determine whether geometry can be compiled with 16-bit indices.
+	/// @return True to compile all geometry with at most 65536 vertices using CompileGeometryIndex16() instead of CompileGeometry().
+	virtual bool Supports16BitIndices();
+	/// Called by RmlUi when it wants to compile geometry with 16-bit indices, only used when Supports16BitIndices() returns true. This
+	/// halves the size of the index data. The returned handle is rendered and released just like those returned by CompileGeometry().
+	/// @param[in] vertices The geometry's vertex data.
+	/// @param[in] num_vertices The number of vertices passed to the function, at most 65536.
+	/// @param[in] indices The geometry's index data.
+	/// @param[in] num_indices The number of indices passed to the function. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr, in which case the geometry is untextured.
+	/// @return The application-specific compiled geometry, or zero to render the geometry using RenderGeometry() instead.
+	virtual CompiledGeometryHandle CompileGeometryIndex16(Vertex* vertices, int num_vertices, uint16_t* indices, int num_indices,
+		TextureHandle texture);
+
+	/// Called by RmlUi to determine whether geometry made up of axis-aligned quads, such as text and images, can be sent as quads.
+	/// @return True to render such geometry through RenderQuads() and CompileQuads(), instead of as vertices and indices.
+	virtual bool SupportsQuads();
+	/// Called by RmlUi when it wants to render axis-aligned quads, only used when SupportsQuads() returns true. Each quad should be
+	/// rendered as two triangles split along the diagonal from its top-right to its bottom-left corner, like the vertices generated
+	/// for it. The default implementation generates these vertices and passes them to RenderGeometry().
+	/// @param[in] quads The quads to render.
+	/// @param[in] num_quads The number of quads passed to the function.
+	/// @param[in] texture The texture to be applied to the quads. This may be nullptr, in which case the quads are untextured.
+	/// @param[in] translation The translation to apply to the quads.
+	virtual void RenderQuads(Quad* quads, int num_quads, TextureHandle texture, const Vector2f& translation);
+	/// Called by RmlUi when it wants to compile axis-aligned quads, only used when SupportsQuads() returns true. The returned handle is
+	/// rendered and released just like those returned by CompileGeometry().
+	/// @param[in] quads The quads to compile.
+	/// @param[in] num_quads The number of quads passed to the function.
+	/// @param[in] texture The texture to be applied to the quads. This may be nullptr, in which case the quads are untextured.
+	/// @return The application-specific compiled geometry, or zero to compile the quads as vertices and indices instead.
+	virtual CompiledGeometryHandle CompileQuads(Quad* quads, int num_quads, TextureHandle texture);
 	/// Called by RmlUi when it wants to render application-compiled geometry.
 	/// @param[in] geometry The application-specific compiled geometry to render.
 	/// @param[in] translation The translation to apply to the geometry.
@@ -101,15 +134,61 @@ public:
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when it wants to replace a region of a texture previously built by GenerateTexture(), such as when adding a glyph to
+	/// a font texture. If this is not supported, the whole texture is generated again instead.
+	/// @param[in] texture_handle The handle of the texture to update.
+	/// @param[in] source The raw 8-bit texture data of the region, in the same format as for GenerateTexture().
+	/// @param[in] region The region of the texture to replace, in pixels.
+	/// @return True if the region was updated, false if updating textures is not supported.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const byte* source, const Rectanglei& region);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
 
+	/// Called by RmlUi to determine whether textures can be rendered as signed distance fields, such as for distance field fonts.
+	/// @return True to enable CreateDistanceFieldTexture().
+	virtual bool SupportsDistanceFieldTextures();
+	/// Called by RmlUi when it wants to render a texture as a signed distance field, only used when SupportsDistanceFieldTextures() returns
+	/// true. The returned handle refers to the same texture data, and geometry rendered with it should use the texture's alpha channel as the
+	/// distance value and multiply the vertex color by the resulting coverage. Values above the edge are inside the shape, and the coverage
+	/// should fade from zero to one over the range [edge - softness, edge + softness], or at least over the width of a pixel to antialias it.
+	/// The handle is released with ReleaseTexture(), which must not release the underlying texture. It may be released after the underlying
+	/// texture.
+	/// @param[in] texture The texture containing the distance field in its alpha channel.
+	/// @param[in] edge The alpha value of the shape's edge, in the range [0, 1].
+	/// @param[in] softness The alpha distance over which the edge fades on each side, in the range [0, 1].
+	/// @return The texture handle which renders the distance field, or zero if distance field textures are not supported.
+	virtual TextureHandle CreateDistanceFieldTexture(TextureHandle texture, float edge, float softness);
+
 	/// Called by RmlUi when it wants the renderer to use a new transform matrix.
 	/// This will only be called if 'transform' properties are encountered. If no transform applies to the current element, nullptr
 	/// is submitted. Then it expects the renderer to use an identity matrix or otherwise omit the multiplication with the transform.
 	/// @param[in] transform The new transform to apply, or nullptr if no transform applies to the current element.
 	virtual void SetTransform(const Matrix4f* transform);
+
+	/// Called by RmlUi at the start of each context render to determine whether its render calls should be batched.
+	/// If enabled, the context records its render calls and submits them as a list where redundant state changes are removed
+	/// and adjacent geometry sharing the same texture, scissor region and transform is merged. When a context renders the
+	/// same commands as on the previous frame, the merged geometry is compiled and re-submitted using RenderCompiledGeometry().
+	/// Custom elements and decorators should then render through Context::GetRenderInterface() to take part in the recording.
+	/// @return True to enable batching, false to submit each render call directly.
+	virtual bool IsBatchingEnabled();
+
+	/// Called by RmlUi when it wants to create a render target for caching the rendered output of an element with 'layer: cached'.
+	/// The render target is used as a texture when compositing the layer, where its premultiplied colors should be blended accordingly.
+	/// It is released with ReleaseTexture().
+	/// @param[in] dimensions The dimensions of the render target, in pixels.
+	/// @return The texture handle of the render target, or zero if render targets are not supported.
+	virtual TextureHandle CreateRenderTarget(const Vector2i& dimensions);
+	/// Called by RmlUi when it wants to redirect rendering into a render target. The render target should be cleared to transparent,
+	/// and its color values should be premultiplied by alpha. Render targets can be nested.
+	/// @param[in] render_target The render target to render into.
+	/// @param[in] region The region of the context covered by the render target. Geometry, scissor regions, and transforms are
+	/// still given in context coordinates, and should be offset by the top-left corner of the region.
+	virtual void PushRenderTarget(TextureHandle render_target, const Rectanglei& region);
+	/// Called by RmlUi when it wants to restore rendering to the previous render target. The scissor region and transform which
+	/// were active when the render target was pushed should be restored.
+	virtual void PopRenderTarget();
 };
 
 } // namespace Rml
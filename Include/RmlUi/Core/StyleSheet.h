@@ -64,7 +64,7 @@ public:
 	/// Merges another style sheet into this.
 	void MergeStyleSheet(const StyleSheet& sheet);
 
-	/// Builds the node index for a combined style sheet.
+	/// Builds the node index and invalidation sets for a combined style sheet.
 	void BuildNodeIndex();
 
 	/// Returns the DecoratorSpecification of the given name, or null if it does not exist.
@@ -83,6 +83,13 @@ public:
 	/// Returns the compiled element definition for a given element and its hierarchy.
 	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
 
+	/// Returns which elements may need their definition updated when the given class is toggled on an element.
+	StyleInvalidation GetClassInvalidation(const String& class_name) const;
+	StyleInvalidation GetClassInvalidation(Atom class_name) const;
+	/// Returns which elements may need their definition updated when the given pseudo class is toggled on an element.
+	StyleInvalidation GetPseudoClassInvalidation(const String& pseudo_class) const;
+	StyleInvalidation GetPseudoClassInvalidation(Atom pseudo_class) const;
+
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
 	const DecoratorPtrList& InstanceDecorators(const DecoratorDeclarationList& declaration_list, const PropertySource* decorator_source) const;
 
@@ -111,6 +118,9 @@ private:
 	// Map of all styled nodes, that is, they have one or more properties.
 	StyleSheetIndex styled_node_index;
 
+	// Classes and pseudo classes used by any node, mapped to the elements affected when they are toggled.
+	StyleSheetInvalidationSets invalidation_sets;
+
 	// Index of node sets to element definitions.
 	using ElementDefinitionCache = UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>>;
 	mutable ElementDefinitionCache node_cache;
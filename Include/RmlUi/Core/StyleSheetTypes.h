@@ -101,12 +101,43 @@ using MediaBlockList = Vector<MediaBlock>;
  */
 struct StyleSheetIndex {
 	using NodeList = Vector<const StyleSheetNode*>;
+	// Nodes indexed by the interned name (atom) of their id, class, or tag.
 	using NodeIndex = UnorderedMap<std::size_t, NodeList>;
 
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
 	NodeIndex ids, classes, tags;
 	NodeList other;
 };
+
+/**
+   Determines which elements may need to have their definition updated when a class or pseudo class is toggled on an element.
+ */
+enum class StyleInvalidation : uint8_t {
+	None = 0,
+	Self = 1 << 0,        // The name is used in the subject position of a styled selector.
+	Descendants = 1 << 1, // The name is used in a compound selector followed by a descendant or child combinator.
+	Siblings = 1 << 2,    // The name is used in a compound selector followed by a sibling combinator.
+	All = Self | Descendants | Siblings,
+};
+inline StyleInvalidation operator|(StyleInvalidation lhs, StyleInvalidation rhs)
+{
+	using underlying_t = std::underlying_type<StyleInvalidation>::type;
+	return static_cast<StyleInvalidation>(static_cast<underlying_t>(lhs) | static_cast<underlying_t>(rhs));
+}
+inline StyleInvalidation operator&(StyleInvalidation lhs, StyleInvalidation rhs)
+{
+	using underlying_t = std::underlying_type<StyleInvalidation>::type;
+	return static_cast<StyleInvalidation>(static_cast<underlying_t>(lhs) & static_cast<underlying_t>(rhs));
+}
+
+/**
+   StyleSheetInvalidationSets records, for every class and pseudo class used by a style sheet, which elements may be affected when it is toggled.
+   Names not used by the style sheet can be toggled without affecting any element definitions.
+ */
+struct StyleSheetInvalidationSets {
+	using InvalidationMap = UnorderedMap<Atom, StyleInvalidation>;
+	InvalidationMap classes, pseudo_classes;
+};
 } // namespace Rml
 
 namespace std {
@@ -143,6 +143,7 @@ namespace Style {
 	enum class Focus : uint8_t { None, Auto };
 	enum class OverscrollBehavior : uint8_t { Auto, Contain };
 	enum class PointerEvents : uint8_t { None, Auto };
+	enum class Layer : uint8_t { Auto, Cached };
 
 	using PerspectiveOrigin = LengthPercentage;
 	using TransformOrigin = LengthPercentage;
@@ -0,0 +1,59 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TASKINTERFACE_H
+#define RMLUI_CORE_TASKINTERFACE_H
+
+#include "Header.h"
+#include "Traits.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    The base class for running independent tasks in parallel.
+
+    By default, RmlUi runs all tasks serially on the calling thread. Applications with a thread pool or job system can derive from this
+    class and install it through Rml::SetTaskInterface() before initialising RmlUi, which lets the default font engine generate the glyphs
+    of its font textures, including font effects, on multiple threads.
+ */
+
+class RMLUICORE_API TaskInterface : public NonCopyMoveable {
+public:
+	TaskInterface();
+	virtual ~TaskInterface();
+
+	/// Runs a task once for every index in the range [0, count), and returns when all of them have completed.
+	/// @param[in] count The number of times to run the task.
+	/// @param[in] task The task to run, which may be called concurrently from multiple threads, once with each index.
+	/// @note The default implementation runs the task for each index in order on the calling thread.
+	virtual void ParallelFor(int count, const Function<void(int)>& task);
+};
+
+} // namespace Rml
+#endif
@@ -75,6 +75,17 @@ public:
 	/// @return The texture's dimensions. This will be (0, 0) if the texture cannot be loaded.
 	Vector2i GetDimensions() const;
 
+	/// Returns the region of the texture handle covered by this texture, in normalized texture coordinates. This is the full texture unless
+	/// the texture is packed into a texture atlas.
+	Rectanglef GetTexCoordRegion() const;
+
+	/// Returns true if the texture is packed into a texture atlas, will attempt to load the texture as necessary. Atlas pages have premultiplied
+	/// alpha, thus vertex colours used with the texture must be premultiplied too.
+	bool IsInAtlas() const;
+	/// Allows the texture to be packed into a shared texture atlas when enabled, see EnableTextureAtlas(). Texture coordinates must then be
+	/// mapped into the region returned by GetTexCoordRegion(), thus the texture cannot be repeated by wrapping its texture coordinates.
+	void AllowAtlas();
+
 	/// Returns true if the texture points to the same underlying resource.
 	bool operator==(const Texture&) const;
 
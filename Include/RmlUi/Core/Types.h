@@ -93,6 +93,7 @@ enum class EventId : uint16_t;
 enum class PropertyId : uint8_t;
 enum class MediaQueryId : uint8_t;
 enum class FamilyId : int;
+enum class Atom : uint32_t;
 
 // Types for external interfaces.
 using FileHandle = uintptr_t;
@@ -168,6 +169,15 @@ struct hash<::Rml::FamilyId> {
 		return h(static_cast<utype>(t));
 	}
 };
+template <>
+struct hash<::Rml::Atom> {
+	using utype = ::std::underlying_type_t<::Rml::Atom>;
+	size_t operator()(const ::Rml::Atom& t) const noexcept
+	{
+		::std::hash<utype> h;
+		return h(static_cast<utype>(t));
+	}
+};
 } // namespace std
 
 #endif
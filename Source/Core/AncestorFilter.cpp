@@ -0,0 +1,133 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AncestorFilter.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "ElementStyle.h"
+
+namespace Rml {
+
+namespace {
+	constexpr uint32_t NumCounterBits = 12;
+	constexpr uint32_t NumCounters = 1u << NumCounterBits;
+	constexpr uint8_t MaxCount = 255;
+
+	struct ParentEntry {
+		const Element* element;
+		// True if all the ancestors of this element are also in the filter.
+		bool complete;
+		// Offset into the key hash stack where the hashes of this element begin.
+		size_t hashes_begin;
+	};
+
+	struct AncestorFilterData {
+		uint8_t counters[NumCounters] = {};
+		Vector<ParentEntry> parents;
+		Vector<uint32_t> hashes;
+	};
+
+	AncestorFilterData& GetData()
+	{
+		static AncestorFilterData data;
+		return data;
+	}
+
+	// Each key sets two counters, taken from the upper bits of the multiplicative hash.
+	inline uint32_t CounterIndex1(uint32_t key_hash)
+	{
+		return key_hash >> (32 - NumCounterBits);
+	}
+	inline uint32_t CounterIndex2(uint32_t key_hash)
+	{
+		return (key_hash >> (32 - 2 * NumCounterBits)) & (NumCounters - 1);
+	}
+
+	void IncrementCounter(uint8_t& counter)
+	{
+		if (counter < MaxCount)
+			counter += 1;
+	}
+	void DecrementCounter(uint8_t& counter)
+	{
+		// Saturated counters stay put, since we no longer know how many keys contributed to them.
+		if (counter > 0 && counter < MaxCount)
+			counter -= 1;
+	}
+} // namespace
+
+void AncestorFilter::PushParent(const Element* element)
+{
+	AncestorFilterData& data = GetData();
+
+	const Element* parent = element->GetParentNode();
+	const bool complete = (!parent || (!data.parents.empty() && data.parents.back().element == parent && data.parents.back().complete));
+	data.parents.push_back(ParentEntry{element, complete, data.hashes.size()});
+
+	const ElementStyle* style = element->GetStyle();
+	data.hashes.push_back(Hash(AncestorFilterKey::Tag, style->GetTag()));
+	if (style->GetId() != Atom::None)
+		data.hashes.push_back(Hash(AncestorFilterKey::Id, style->GetId()));
+	for (Atom name : style->GetClassList())
+		data.hashes.push_back(Hash(AncestorFilterKey::Class, name));
+
+	for (size_t i = data.parents.back().hashes_begin; i < data.hashes.size(); i++)
+	{
+		IncrementCounter(data.counters[CounterIndex1(data.hashes[i])]);
+		IncrementCounter(data.counters[CounterIndex2(data.hashes[i])]);
+	}
+}
+
+void AncestorFilter::PopParent()
+{
+	AncestorFilterData& data = GetData();
+	RMLUI_ASSERT(!data.parents.empty());
+
+	const size_t hashes_begin = data.parents.back().hashes_begin;
+	for (size_t i = hashes_begin; i < data.hashes.size(); i++)
+	{
+		DecrementCounter(data.counters[CounterIndex1(data.hashes[i])]);
+		DecrementCounter(data.counters[CounterIndex2(data.hashes[i])]);
+	}
+
+	data.hashes.resize(hashes_begin);
+	data.parents.pop_back();
+}
+
+bool AncestorFilter::IsValidFor(const Element* element)
+{
+	const AncestorFilterData& data = GetData();
+	return !data.parents.empty() && data.parents.back().complete && data.parents.back().element == element->GetParentNode();
+}
+
+bool AncestorFilter::MayContain(uint32_t key_hash)
+{
+	const AncestorFilterData& data = GetData();
+	return data.counters[CounterIndex1(key_hash)] != 0 && data.counters[CounterIndex2(key_hash)] != 0;
+}
+
+} // namespace Rml
@@ -0,0 +1,67 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
+
+namespace Rml {
+
+class Element;
+
+enum class AncestorFilterKey : uint32_t { Tag, Id, Class };
+
+/**
+    A counting bloom filter of the tags, ids and classes of the current element's ancestors.
+
+    The filter is filled during the recursive element update, so that when resolving element definitions, any style sheet node requiring an
+    ancestor name that is definitely absent can be rejected without walking up the element tree. False positives are possible, false negatives are
+    not. The filter is only used for elements whose entire parent chain has been pushed, otherwise we fall back to regular matching.
+ */
+namespace AncestorFilter {
+	/// Adds the given element to the filter, to be called before updating its children.
+	void PushParent(const Element* element);
+	/// Removes the most recently pushed element from the filter, to be called after updating its children.
+	void PopParent();
+
+	/// Returns true if the filter currently contains exactly the ancestors of the given element.
+	bool IsValidFor(const Element* element);
+	/// Returns false if the given key is definitely not present among the ancestors.
+	bool MayContain(uint32_t key_hash);
+
+	/// Returns the hash of a name as used by the filter, the key type is included to avoid collisions between e.g. tags and classes.
+	inline uint32_t Hash(AncestorFilterKey key, Atom atom)
+	{
+		return ((static_cast<uint32_t>(atom) << 2) | static_cast<uint32_t>(key)) * 0x9E3779B1u;
+	}
+} // namespace AncestorFilter
+
+} // namespace Rml
+#endif
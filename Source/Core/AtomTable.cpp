@@ -0,0 +1,99 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AtomTable.h"
+
+namespace Rml {
+
+namespace {
+	struct AtomTableData {
+		AtomTableData()
+		{
+			for (const char* name : {"", "#text", "#spacer"})
+			{
+				atoms.emplace(name, static_cast<Atom>(names.size()));
+				names.emplace_back(name);
+			}
+		}
+
+		Vector<String> names; // Atoms are indices into the name list.
+		UnorderedMap<String, Atom> atoms;
+	};
+} // namespace
+
+static AtomTableData& GetAtomTableData()
+{
+	static AtomTableData data;
+	return data;
+}
+
+// Not reset by Clear(), so that atoms looked up before clearing are never considered up to date.
+uint32_t AtomTable::Detail::generation = 1;
+
+Atom AtomTable::GetOrCreate(const String& name)
+{
+	AtomTableData& data = GetAtomTableData();
+
+	const Atom next_atom = static_cast<Atom>(data.names.size());
+	auto result = data.atoms.emplace(name, next_atom);
+	if (result.second)
+	{
+		data.names.push_back(name);
+		Detail::generation += 1;
+	}
+
+	return result.first->second;
+}
+
+Atom AtomTable::Find(const String& name)
+{
+	const AtomTableData& data = GetAtomTableData();
+
+	auto it = data.atoms.find(name);
+	if (it != data.atoms.end())
+		return it->second;
+
+	return Atom::None;
+}
+
+const String& AtomTable::GetName(Atom atom)
+{
+	const AtomTableData& data = GetAtomTableData();
+
+	const size_t index = static_cast<size_t>(atom);
+	RMLUI_ASSERT(index < data.names.size());
+	return data.names[index];
+}
+
+void AtomTable::Clear()
+{
+	GetAtomTableData() = AtomTableData();
+	Detail::generation += 1;
+}
+
+} // namespace Rml
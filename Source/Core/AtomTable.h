@@ -0,0 +1,84 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ATOMTABLE_H
+#define RMLUI_CORE_ATOMTABLE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    An atom is an integer identifier uniquely representing a name, such as a tag, id, class, or pseudo class.
+
+    Atoms are used for selector matching so that names can be compared by value instead of by string. The empty string is always represented by
+    the 'None' atom.
+
+    Names are interned by style sheets and elements' tags. Class names and ids set on elements are only looked up, so that names generated at
+    runtime do not grow the table. Names which have not been interned cannot be used by any selector, thus they don't affect matching. The table
+    is cleared during shutdown.
+ */
+enum class Atom : uint32_t { None = 0 };
+using AtomList = Vector<Atom>;
+
+namespace AtomTable {
+	/// The atom of the tag of text elements, '#text', which is always present in the table.
+	constexpr Atom TextTag = static_cast<Atom>(1);
+	/// The atom of the tag of the spacer elements inserted by virtualized data views, '#spacer', which is always present in the table.
+	constexpr Atom SpacerTag = static_cast<Atom>(2);
+
+	/// Returns the atom of the given name, creating it if it does not already exist.
+	Atom GetOrCreate(const String& name);
+	/// Returns the atom of the given name, or 'None' if the name has never been interned.
+	Atom Find(const String& name);
+	/// Returns the name of the given atom.
+	const String& GetName(Atom atom);
+
+	namespace Detail {
+		extern uint32_t generation;
+	}
+	/// Returns a number which changes whenever names are added to the table, or the table is cleared. Atoms looked up with Find() must be
+	/// looked up again when it changes.
+	inline uint32_t GetGeneration()
+	{
+		return Detail::generation;
+	}
+	/// Removes all names from the table, except for those always present.
+	void Clear();
+} // namespace AtomTable
+
+/// Returns the bit representing the given atom in a 64-bit atom mask. Several atoms may share the same bit, thus masks can only be used to rule out
+/// the presence of atoms.
+inline uint64_t GetAtomMaskBit(Atom atom)
+{
+	return uint64_t(1) << (static_cast<uint32_t>(atom) & 63u);
+}
+
+} // namespace Rml
+
+#endif
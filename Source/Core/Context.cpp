@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
@@ -42,8 +43,10 @@
 #include "DataModel.h"
 #include "EventDispatcher.h"
 #include "PluginRegistry.h"
+#include "RenderCommandList.h"
 #include "ScrollController.h"
 #include "StreamFile.h"
+#include "TextureAtlas.h"
 #include <algorithm>
 #include <iterator>
 #include <limits>
@@ -143,6 +146,7 @@ void Context::SetDimensions(const Vector2i _dimensions)
 		}
 
 		clip_dimensions = dimensions;
+		DirtyRender();
 	}
 }
 
@@ -180,6 +184,14 @@ bool Context::Update()
 
 	next_update_timeout = std::numeric_limits<double>::infinity();
 
+	// Evicting glyphs releases font textures, so all contexts must regenerate their text and record their rendering again.
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	if (font_engine_interface && font_engine_interface->TrimGlyphCache())
+	{
+		for (int i = 0; i < GetNumContexts(); i++)
+			GetContext(i)->DirtyRender();
+	}
+
 	if (scroll_controller->Update(mouse_position, density_independent_pixel_ratio))
 		RequestNextUpdate(0);
 
@@ -218,8 +230,44 @@ bool Context::Render()
 {
 	RMLUI_ZoneScoped;
 
+	// Atlas pages must be up-to-date before any textures on them are rendered.
+	TextureAtlas::BeginRender();
+
+	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	const bool record = (render_interface && (dirty_regions_enabled || render_interface->IsBatchingEnabled()));
+	if (!record)
+	{
+		render_commands.reset();
+		render_commands_pending = false;
+		RenderElements();
+		render_dirty = false;
+		TextureAtlas::EndRender();
+		return true;
+	}
+
+	UpdateRenderCommands(render_interface);
+
+	const bool restrict_render = (dirty_regions_enabled && dirty_regions_restrict_render);
+	render_commands->Submit(restrict_render ? &dirty_regions : nullptr);
+	render_commands_pending = false;
+	dirty_regions_submitted = true;
+
+	TextureAtlas::EndRender();
+	return true;
+}
+
+RenderInterface* Context::GetRenderInterface() const
+{
+	if (render_commands && RenderCommandList::GetRecordingList() == render_commands.get())
+		return RenderCommandList::GetRecordingInterface();
+	return ::Rml::GetRenderInterface();
+}
+
+void Context::RenderElements()
+{
 	ElementUtilities::ApplyActiveClipRegion(this);
 
+	Element::BeginRenderPass();
 	root->Render();
 
 	ElementUtilities::SetClippingRegion(nullptr, this);
@@ -232,8 +280,147 @@ bool Context::Render()
 			Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x), (float)Math::Clamp(mouse_position.y, 0, dimensions.y)), nullptr);
 		cursor_proxy->Render();
 	}
+}
 
-	return true;
+void Context::RecordRender(RenderInterface* render_interface)
+{
+	if (!render_commands)
+		render_commands = MakeUnique<RenderCommandList>();
+
+	// Start a new set of dirty regions, unless the previous ones have not been submitted yet.
+	if (dirty_regions_submitted)
+	{
+		dirty_regions.clear();
+		dirty_regions_submitted = false;
+	}
+
+	render_commands->BeginRecording(render_interface, dirty_regions_enabled);
+	RenderElements();
+	render_commands->EndRecording();
+
+	MergeDirtyRegions();
+
+	render_dirty = false;
+	render_commands_pending = true;
+}
+
+void Context::UpdateRenderCommands(RenderInterface* render_interface)
+{
+	// The commands may already have been recorded when the dirty regions were requested, in which case only further changes need a new
+	// recording. Otherwise, the previous commands are replayed as long as nothing has changed since they were recorded.
+	const bool dirty = (render_dirty || (!render_commands_pending && IsRenderDirty()));
+	if (dirty || !render_commands || !render_commands->CanReplay(render_interface))
+	{
+		RecordRender(render_interface);
+	}
+	else if (dirty_regions_submitted)
+	{
+		dirty_regions.clear();
+		dirty_regions_submitted = false;
+	}
+}
+
+bool Context::IsRenderDirty() const
+{
+	// The drag clone follows the mouse during rendering, so it is always considered dirty.
+	return render_dirty || drag_clone;
+}
+
+void Context::DirtyRender()
+{
+	render_dirty = true;
+	AddDirtyRegion(Rectanglef::FromSize(Vector2f(dimensions)));
+}
+
+void Context::EnableDirtyRegions(bool enable, bool restrict_render)
+{
+	if (enable && !dirty_regions_enabled)
+	{
+		dirty_regions_enabled = true;
+		DirtyRender();
+	}
+	else if (!enable && dirty_regions_enabled)
+	{
+		dirty_regions_enabled = false;
+		dirty_regions.clear();
+		render_commands_pending = false;
+	}
+
+	dirty_regions_restrict_render = restrict_render;
+}
+
+const Vector<Rectanglei>& Context::GetDirtyRegions()
+{
+	if (dirty_regions_enabled)
+	{
+		if (RenderInterface* render_interface = ::Rml::GetRenderInterface())
+			UpdateRenderCommands(render_interface);
+	}
+
+	return dirty_regions;
+}
+
+void Context::AddDirtyRegion(Rectanglef region)
+{
+	if (!dirty_regions_enabled || !(region.Width() > 0.f && region.Height() > 0.f))
+		return;
+
+	if (dirty_regions_submitted)
+	{
+		dirty_regions.clear();
+		dirty_regions_submitted = false;
+	}
+
+	const Rectanglef context_region = Rectanglef::FromSize(Vector2f(dimensions));
+	if (!region.Intersects(context_region))
+		return;
+	region.Intersect(context_region);
+
+	dirty_regions.push_back(Rectanglei::FromCorners(Vector2i(Math::RoundDownToInteger(region.Left()), Math::RoundDownToInteger(region.Top())),
+		Vector2i(Math::RoundUpToInteger(region.Right()), Math::RoundUpToInteger(region.Bottom()))));
+}
+
+void Context::MergeDirtyRegions()
+{
+	// Beyond this number of regions, they are all joined into a single region.
+	static constexpr size_t max_num_regions = 16;
+
+	auto JoinAllRegions = [this]() {
+		Rectanglei region = dirty_regions[0];
+		for (const Rectanglei& other : dirty_regions)
+			region.Join(other);
+		dirty_regions.assign(1, region);
+	};
+
+	// Avoid the quadratic joining below when there are many regions, such as after a layout change.
+	if (dirty_regions.size() > 4 * max_num_regions)
+	{
+		JoinAllRegions();
+		return;
+	}
+
+	// Join overlapping regions until they are all disjoint, this avoids blending the same pixels several times when rendering them.
+	bool joined = true;
+	while (joined)
+	{
+		joined = false;
+		for (size_t i = 0; i < dirty_regions.size() && !joined; i++)
+		{
+			for (size_t j = i + 1; j < dirty_regions.size(); j++)
+			{
+				if (dirty_regions[i].Intersects(dirty_regions[j]))
+				{
+					dirty_regions[i].Join(dirty_regions[j]);
+					dirty_regions.erase(dirty_regions.begin() + j);
+					joined = true;
+					break;
+				}
+			}
+		}
+	}
+
+	if (dirty_regions.size() > max_num_regions)
+		JoinAllRegions();
 }
 
 ElementDocument* Context::CreateDocument(const String& instancer_name)
@@ -474,6 +661,7 @@ void Context::PullDocumentToFront(ElementDocument* document)
 				root->children.insert(root->children.begin() + root->GetNumChildren(), std::move(element));
 
 				root->DirtyStackingContext();
+				DirtyRender();
 			}
 		}
 	}
@@ -493,6 +681,7 @@ void Context::PushDocumentToBack(ElementDocument* document)
 				root->children.insert(root->children.begin(), std::move(element));
 
 				root->DirtyStackingContext();
+				DirtyRender();
 			}
 		}
 	}
@@ -924,6 +1113,8 @@ bool Context::RemoveDataModel(const String& name)
 
 void Context::OnElementDetach(Element* element)
 {
+	render_dirty = true;
+
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
@@ -28,11 +28,123 @@
 
 #include "../../Include/RmlUi/Core/ConvolutionFilter.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "Memory.h"
+#include <algorithm>
 #include <float.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RMLUI_CONVOLUTION_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define RMLUI_CONVOLUTION_NEON
+	#include <arm_neon.h>
+#endif
+
 namespace Rml {
 
+using FloatBuffer = DynamicArray<float, GlobalStackAllocator<float>>;
+
+// A non-zero kernel value, at the given kernel position.
+struct KernelTap {
+	int x, y;
+	float weight;
+};
+
+// A horizontal span of kernel values equal to one, starting at the given kernel position.
+struct KernelSpan {
+	int x, y;
+	int length;
+};
+
+// Adds the source values multiplied by the weight to the result values.
+static void MultiplyAdd(float* result, const float* source, const float weight, const int count)
+{
+	int i = 0;
+#if defined(RMLUI_CONVOLUTION_SSE2)
+	const __m128 weight4 = _mm_set1_ps(weight);
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(result + i, _mm_add_ps(_mm_loadu_ps(result + i), _mm_mul_ps(_mm_loadu_ps(source + i), weight4)));
+#elif defined(RMLUI_CONVOLUTION_NEON)
+	const float32x4_t weight4 = vdupq_n_f32(weight);
+	for (; i + 4 <= count; i += 4)
+		vst1q_f32(result + i, vaddq_f32(vld1q_f32(result + i), vmulq_f32(vld1q_f32(source + i), weight4)));
+#endif
+	for (; i < count; i++)
+		result[i] += source[i] * weight;
+}
+
+// Sets the result values to the larger of themselves and the source values multiplied by the weight.
+static void MultiplyMax(float* result, const float* source, const float weight, const int count)
+{
+	int i = 0;
+#if defined(RMLUI_CONVOLUTION_SSE2)
+	const __m128 weight4 = _mm_set1_ps(weight);
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(result + i, _mm_max_ps(_mm_loadu_ps(result + i), _mm_mul_ps(_mm_loadu_ps(source + i), weight4)));
+#elif defined(RMLUI_CONVOLUTION_NEON)
+	const float32x4_t weight4 = vdupq_n_f32(weight);
+	for (; i + 4 <= count; i += 4)
+		vst1q_f32(result + i, vmaxq_f32(vld1q_f32(result + i), vmulq_f32(vld1q_f32(source + i), weight4)));
+#endif
+	for (; i < count; i++)
+		result[i] = Math::Max(result[i], source[i] * weight);
+}
+
+// Finds the maximum of every window of consecutive source values with the given length, writing (count - length + 1) results. Uses the van
+// Herk/Gil-Werman algorithm, which takes a constant number of comparisons per value regardless of the window length.
+static void RunningMax(float* result, const float* source, const int count, const int length, float* prefix_max, float* suffix_max)
+{
+	for (int block_begin = 0; block_begin < count; block_begin += length)
+	{
+		const int block_end = Math::Min(block_begin + length, count);
+
+		prefix_max[block_begin] = source[block_begin];
+		for (int i = block_begin + 1; i < block_end; i++)
+			prefix_max[i] = Math::Max(prefix_max[i - 1], source[i]);
+
+		suffix_max[block_end - 1] = source[block_end - 1];
+		for (int i = block_end - 2; i >= block_begin; i--)
+			suffix_max[i] = Math::Max(suffix_max[i + 1], source[i]);
+	}
+
+	// Each window covers the end of one block and the beginning of the next.
+	for (int i = 0; i + length <= count; i++)
+		result[i] = Math::Max(suffix_max[i], prefix_max[i + length - 1]);
+}
+
+// Splits the kernel into the product of a row and a column vector, if possible.
+static bool SeparateKernel(const float* kernel, const Vector2i kernel_size, Vector<float>& row_weights, Vector<float>& column_weights)
+{
+	const float* pivot = std::max_element(kernel, kernel + kernel_size.x * kernel_size.y,
+		[](float a, float b) { return Math::Absolute(a) < Math::Absolute(b); });
+	const float pivot_value = *pivot;
+	if (pivot_value == 0.f)
+		return false;
+
+	const int pivot_x = int(pivot - kernel) % kernel_size.x;
+	const int pivot_y = int(pivot - kernel) / kernel_size.x;
+
+	row_weights.resize(kernel_size.x);
+	column_weights.resize(kernel_size.y);
+	for (int x = 0; x < kernel_size.x; x++)
+		row_weights[x] = kernel[pivot_y * kernel_size.x + x];
+	for (int y = 0; y < kernel_size.y; y++)
+		column_weights[y] = kernel[y * kernel_size.x + pivot_x] / pivot_value;
+
+	const float tolerance = 1e-5f * Math::Absolute(pivot_value);
+	for (int y = 0; y < kernel_size.y; y++)
+	{
+		for (int x = 0; x < kernel_size.x; x++)
+		{
+			if (Math::Absolute(kernel[y * kernel_size.x + x] - row_weights[x] * column_weights[y]) > tolerance)
+				return false;
+		}
+	}
+
+	return true;
+}
+
 ConvolutionFilter::ConvolutionFilter() {}
 
 ConvolutionFilter::~ConvolutionFilter() {}
@@ -73,6 +185,9 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 {
 	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
 
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
 	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
 	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
@@ -80,40 +195,163 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
-	for (int y = 0; y < destination_dimensions.y; ++y)
+	// Copy the source opacity into a buffer with a border of zeroes, covering all pixels read by the kernel. Then, each row of the result is
+	// a combination of whole rows of this buffer, without any bounds checks. Pixels outside the source make no difference to the result.
+	const Vector2i padded_dimensions = destination_dimensions + kernel_size - Vector2i(1);
+	const int padded_size = padded_dimensions.x * padded_dimensions.y;
+	const Vector2i padded_source_offset = source_offset + kernel_radius;
+
+	FloatBuffer padded(padded_size);
+	std::fill(padded.data(), padded.data() + padded_size, 0.f);
+
+	const int padded_x_begin = Math::Clamp(padded_source_offset.x, 0, padded_dimensions.x);
+	const int padded_x_end = Math::Clamp(padded_source_offset.x + source_dimensions.x, 0, padded_dimensions.x);
+	for (int y = 0; y < padded_dimensions.y; ++y)
 	{
+		const int source_y = y - padded_source_offset.y;
+		if (source_y < 0 || source_y >= source_dimensions.y)
+			continue;
+
+		float* padded_row = padded.data() + y * padded_dimensions.x;
+		for (int x = padded_x_begin; x < padded_x_end; ++x)
+		{
+			const int source_index = (source_y * source_dimensions.x + x - padded_source_offset.x) * source_bytes_per_pixel + source_alpha_offset;
+			padded_row[x] = float(source[source_index]);
+		}
+	}
+
+	FloatBuffer opacity(destination_dimensions.x);
+
+	auto WriteRow = [&](int y) {
+		byte* destination_row = destination + y * destination_stride + destination_alpha_offset;
 		for (int x = 0; x < destination_dimensions.x; ++x)
+			destination_row[x * destination_bytes_per_pixel] = byte(Math::Min(255.f, opacity[x]));
+	};
+
+	Vector<float> row_weights, column_weights;
+	const bool is_separable = (operation == FilterOperation::Sum && kernel_size.x > 1 && kernel_size.y > 1 &&
+		SeparateKernel(kernel.get(), kernel_size, row_weights, column_weights));
+
+	if (is_separable)
+	{
+		// Separable kernels, such as Gaussian kernels, are applied as a horizontal pass followed by a vertical pass.
+		const int horizontal_size = destination_dimensions.x * padded_dimensions.y;
+		FloatBuffer horizontal(horizontal_size);
+		std::fill(horizontal.data(), horizontal.data() + horizontal_size, 0.f);
+
+		for (int y = 0; y < padded_dimensions.y; ++y)
 		{
-			float opacity = 0.f;
+			for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+			{
+				if (row_weights[kernel_x] != 0.f)
+					MultiplyAdd(horizontal.data() + y * destination_dimensions.x, padded.data() + y * padded_dimensions.x + kernel_x,
+						row_weights[kernel_x], destination_dimensions.x);
+			}
+		}
 
+		for (int y = 0; y < destination_dimensions.y; ++y)
+		{
+			std::fill(opacity.data(), opacity.data() + destination_dimensions.x, 0.f);
 			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
 			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
-
-				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
-				{
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-
-						switch (operation)
-						{
-						case FilterOperation::Sum: opacity += pixel_opacity; break;
-						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-						}
-					}
-				}
+				if (column_weights[kernel_y] != 0.f)
+					MultiplyAdd(opacity.data(), horizontal.data() + (y + kernel_y) * destination_dimensions.x, column_weights[kernel_y],
+						destination_dimensions.x);
+			}
+			WriteRow(y);
+		}
+		return;
+	}
+
+	// Collect the non-zero kernel values. For dilation, the longest span of ones in each kernel row is instead looked up from the running
+	// maximum of the source rows, which is shared between all kernel rows with spans of the same length.
+	Vector<KernelTap> taps;
+	Vector<KernelSpan> spans;
+	Vector<int> span_lengths;
+
+	for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+	{
+		const float* kernel_row = kernel.get() + kernel_y * kernel_size.x;
+
+		KernelSpan span = {0, kernel_y, 0};
+		if (operation == FilterOperation::Dilation)
+		{
+			for (int kernel_x = 0; kernel_x < kernel_size.x;)
+			{
+				int length = 0;
+				while (kernel_x + length < kernel_size.x && kernel_row[kernel_x + length] == 1.f)
+					length++;
+				if (length > span.length)
+					span = KernelSpan{kernel_x, kernel_y, length};
+				kernel_x += Math::Max(length, 1);
+			}
+
+			if (span.length > 1)
+			{
+				spans.push_back(span);
+				if (std::find(span_lengths.begin(), span_lengths.end(), span.length) == span_lengths.end())
+					span_lengths.push_back(span.length);
+			}
+			else
+			{
+				span.length = 0;
 			}
+		}
+
+		for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+		{
+			const bool in_span = (kernel_x >= span.x && kernel_x < span.x + span.length);
+			if (kernel_row[kernel_x] != 0.f && !in_span)
+				taps.push_back(KernelTap{kernel_x, kernel_y, kernel_row[kernel_x]});
+		}
+	}
 
-			opacity = Math::Min(255.f, opacity);
+	switch (operation)
+	{
+	case FilterOperation::Sum:
+	{
+		// The taps are added in kernel order, giving the same result as a per-pixel loop over the kernel.
+		for (int y = 0; y < destination_dimensions.y; ++y)
+		{
+			std::fill(opacity.data(), opacity.data() + destination_dimensions.x, 0.f);
+			for (const KernelTap& tap : taps)
+				MultiplyAdd(opacity.data(), padded.data() + (y + tap.y) * padded_dimensions.x + tap.x, tap.weight, destination_dimensions.x);
+			WriteRow(y);
+		}
+	}
+	break;
+	case FilterOperation::Dilation:
+	{
+		const int running_max_size = padded_size * (int)span_lengths.size();
+		FloatBuffer running_max(running_max_size);
+		FloatBuffer prefix_max(padded_dimensions.x);
+		FloatBuffer suffix_max(padded_dimensions.x);
 
-			const int destination_index = x * destination_bytes_per_pixel + destination_alpha_offset;
-			destination[destination_index] = byte(opacity);
+		for (size_t i = 0; i < span_lengths.size(); i++)
+		{
+			for (int y = 0; y < padded_dimensions.y; ++y)
+			{
+				const int row_offset = y * padded_dimensions.x;
+				RunningMax(running_max.data() + i * padded_size + row_offset, padded.data() + row_offset, padded_dimensions.x, span_lengths[i],
+					prefix_max.data(), suffix_max.data());
+			}
 		}
 
-		destination += destination_stride;
+		for (int y = 0; y < destination_dimensions.y; ++y)
+		{
+			std::fill(opacity.data(), opacity.data() + destination_dimensions.x, 0.f);
+			for (const KernelSpan& span : spans)
+			{
+				const int i = int(std::find(span_lengths.begin(), span_lengths.end(), span.length) - span_lengths.begin());
+				MultiplyMax(opacity.data(), running_max.data() + i * padded_size + (y + span.y) * padded_dimensions.x + span.x, 1.f,
+					destination_dimensions.x);
+			}
+			for (const KernelTap& tap : taps)
+				MultiplyMax(opacity.data(), padded.data() + (y + tap.y) * padded_dimensions.x + tap.x, tap.weight, destination_dimensions.x);
+			WriteRow(y);
+		}
+	}
+	break;
 	}
 }
 
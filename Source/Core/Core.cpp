@@ -36,14 +36,19 @@
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/TaskInterface.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
+#include "ElementLayer.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "GeometryDatabase.h"
 #include "PluginRegistry.h"
+#include "RenderCommandList.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "TemplateCache.h"
+#include "TextureAtlas.h"
 #include "TextureDatabase.h"
 
 #ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
@@ -70,10 +75,13 @@ static SystemInterface* system_interface = nullptr;
 static FileInterface* file_interface = nullptr;
 // RmlUi's font engine interface.
 static FontEngineInterface* font_interface = nullptr;
+// RmlUi's task interface.
+static TaskInterface* task_interface = nullptr;
 
 // Default interfaces should be created and destroyed on Initialise and Shutdown, respectively.
 static UniquePtr<FileInterface> default_file_interface;
 static UniquePtr<FontEngineInterface> default_font_interface;
+static UniquePtr<TaskInterface> default_task_interface;
 
 static bool initialised = false;
 
@@ -116,6 +124,12 @@ bool Initialise()
 #endif
 	}
 
+	if (!task_interface)
+	{
+		default_task_interface = MakeUnique<TaskInterface>();
+		task_interface = default_task_interface.get();
+	}
+
 	EventSpecificationInterface::Initialize();
 
 	TextureDatabase::Initialise();
@@ -175,14 +189,19 @@ void Shutdown()
 	default_font_interface.reset();
 
 	TextureDatabase::Shutdown();
+	TextureAtlas::Shutdown();
+	RenderCommandList::Shutdown();
+	AtomTable::Clear();
 
 	initialised = false;
 
 	render_interface = nullptr;
 	file_interface = nullptr;
 	system_interface = nullptr;
+	task_interface = nullptr;
 
 	default_file_interface.reset();
+	default_task_interface.reset();
 
 	Log::Shutdown();
 
@@ -241,6 +260,16 @@ FontEngineInterface* GetFontEngineInterface()
 	return font_interface;
 }
 
+void SetTaskInterface(TaskInterface* _task_interface)
+{
+	task_interface = _task_interface;
+}
+
+TaskInterface* GetTaskInterface()
+{
+	return task_interface;
+}
+
 Context* CreateContext(const String& name, const Vector2i dimensions)
 {
 	if (!initialised)
@@ -350,9 +379,15 @@ StringList GetTextureSourceList()
 	return TextureDatabase::GetSourceList();
 }
 
+void EnableTextureAtlas(int max_image_size, int page_size)
+{
+	TextureAtlas::Enable(max_image_size, page_size);
+}
+
 void ReleaseTextures()
 {
 	TextureDatabase::ReleaseTextures();
+	ElementLayer::ReleaseAll();
 }
 
 bool ReleaseTexture(const String& source)
@@ -362,9 +397,15 @@ bool ReleaseTexture(const String& source)
 
 void ReleaseCompiledGeometry()
 {
+	RenderCommandList::ReleaseAllCompiledGeometry();
 	return GeometryDatabase::ReleaseAll();
 }
 
+GeometryMemoryStats GetGeometryMemoryStats()
+{
+	return GeometryDatabase::GetStats();
+}
+
 void ReleaseMemoryPools()
 {
 	if (observerPtrBlockPool && observerPtrBlockPool->GetNumAllocatedObjects() <= 0)
@@ -372,6 +413,8 @@ void ReleaseMemoryPools()
 		delete observerPtrBlockPool;
 		observerPtrBlockPool = nullptr;
 	}
+
+	GeometryDatabase::Compact();
 }
 
 void ReleaseFontResources()
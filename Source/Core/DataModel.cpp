@@ -34,6 +34,9 @@
 
 namespace Rml {
 
+static const String iteration_item_entry_name = "#item";
+static const String iteration_index_entry_name = "#index";
+
 static DataAddress ParseAddress(const String& address_str)
 {
 	StringList list;
@@ -107,7 +110,7 @@ static String DataAddressToString(const DataAddress& address)
 	bool is_first = true;
 	for (auto& entry : address)
 	{
-		if (entry.index >= 0)
+		if (entry.name.empty())
 			result += '[' + ToString(entry.index) + ']';
 		else
 		{
@@ -249,6 +252,11 @@ void DataModel::CopyAliases(Element* from_element, Element* to_element)
 	}
 }
 
+DataAddress DataModel::ParseAddress(const String& address_str)
+{
+	return Rml::ParseAddress(address_str);
+}
+
 DataAddress DataModel::ResolveAddress(const String& address_str, Element* element) const
 {
 	DataAddress address = ParseAddress(address_str);
@@ -308,7 +316,11 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 
 		for (int i = 1; i < (int)address.size() && variable; i++)
 		{
-			variable = variable.Child(address[i]);
+			const DataAddressEntry& entry = address[i];
+			if (!entry.name.empty() && entry.name[0] == '#')
+				variable = GetIterationVariable(variable, entry);
+			else
+				variable = variable.Child(entry);
 			if (!variable)
 				return DataVariable();
 		}
@@ -325,6 +337,59 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	return DataVariable();
 }
 
+DataVariable DataModel::GetIterationVariable(DataVariable container, const DataAddressEntry& entry) const
+{
+	if (entry.index < 0 || entry.index >= (int)iteration_indices.size())
+		return DataVariable();
+
+	const int index = iteration_indices[entry.index];
+	if (entry.name == iteration_index_entry_name)
+		return MakeLiteralIntVariable(index);
+
+	return container.Child(DataAddressEntry(index));
+}
+
+int DataModel::CreateIterationHandle(int index)
+{
+	if (!free_iteration_handles.empty())
+	{
+		const int handle = free_iteration_handles.back();
+		free_iteration_handles.pop_back();
+		iteration_indices[handle] = index;
+		return handle;
+	}
+
+	iteration_indices.push_back(index);
+	return (int)iteration_indices.size() - 1;
+}
+
+void DataModel::SetIterationHandleIndex(int handle, int index)
+{
+	RMLUI_ASSERT(handle >= 0 && handle < (int)iteration_indices.size());
+	iteration_indices[handle] = index;
+}
+
+void DataModel::ReleaseIterationHandle(int handle)
+{
+	RMLUI_ASSERT(handle >= 0 && handle < (int)iteration_indices.size());
+	iteration_indices[handle] = -1;
+	free_iteration_handles.push_back(handle);
+}
+
+DataAddressEntry DataModel::MakeIterationItemEntry(int handle)
+{
+	DataAddressEntry entry(iteration_item_entry_name);
+	entry.index = handle;
+	return entry;
+}
+
+DataAddressEntry DataModel::MakeIterationIndexEntry(int handle)
+{
+	DataAddressEntry entry(iteration_index_entry_name);
+	entry.index = handle;
+	return entry;
+}
+
 const DataEventFunc* DataModel::GetEventCallback(const String& name)
 {
 	auto it = event_callbacks.find(name);
@@ -346,25 +411,67 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 	return result;
 }
 
+bool DataModel::HasVariable(const String& variable_name) const
+{
+	return variables.count(variable_name) == 1;
+}
+
+int DataModel::GetVariableId(const String& variable_name)
+{
+	auto it = variable_ids.find(variable_name);
+	if (it != variable_ids.end())
+		return it->second;
+
+	const int variable_id = (int)dirty_variable_flags.size();
+	variable_ids.emplace(variable_name, variable_id);
+	dirty_variable_flags.push_back(false);
+	return variable_id;
+}
+
+void DataModel::DirtyVariable(int variable_id)
+{
+	if (variable_id < 0 || variable_id >= (int)dirty_variable_flags.size())
+	{
+		Log::Message(Log::LT_ERROR, "In DirtyVariable: Invalid variable id %d.", variable_id);
+		return;
+	}
+	if (!dirty_variable_flags[variable_id])
+	{
+		dirty_variable_flags[variable_id] = true;
+		dirty_variable_ids.push_back(variable_id);
+	}
+}
+
+bool DataModel::IsVariableDirty(int variable_id) const
+{
+	if (variable_id < 0 || variable_id >= (int)dirty_variable_flags.size())
+	{
+		Log::Message(Log::LT_ERROR, "In IsVariableDirty: Invalid variable id %d.", variable_id);
+		return false;
+	}
+	return dirty_variable_flags[variable_id];
+}
+
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
 	RMLUI_ASSERTMSG(variables.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
-	dirty_variables.emplace(variable_name);
+	DirtyVariable(GetVariableId(variable_name));
 }
 
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	auto it = variable_ids.find(variable_name);
+	return it != variable_ids.end() && dirty_variable_flags[it->second];
 }
 
 void DataModel::DirtyAllVariables()
 {
-	dirty_variables.reserve(variables.size());
+	dirty_variable_ids.reserve(variables.size());
 	for (const auto& variable : variables)
 	{
-		dirty_variables.emplace(variable.first);
+		DirtyVariable(GetVariableId(variable.first));
 	}
 }
 
@@ -395,10 +502,14 @@ void DataModel::OnElementRemove(Element* element)
 
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, dirty_variable_ids);
 
 	if (clear_dirty_variables)
-		dirty_variables.clear();
+	{
+		for (int variable_id : dirty_variable_ids)
+			dirty_variable_flags[variable_id] = false;
+		dirty_variable_ids.clear();
+	}
 
 	return result;
 }
@@ -61,11 +61,28 @@ public:
 	void CopyAliases(Element* source_element, Element* target_element);
 
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
+	static DataAddress ParseAddress(const String& address_str);
 	const DataEventFunc* GetEventCallback(const String& name);
 
 	DataVariable GetVariable(const DataAddress& address) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
+	// Iteration handles let the rows of keyed 'data-for' views refer to their container index indirectly. The index of a handle can be changed
+	// when its row is moved, without having to resolve the addresses of the data views in the row again.
+	int CreateIterationHandle(int index);
+	void SetIterationHandleIndex(int handle, int index);
+	void ReleaseIterationHandle(int handle);
+	// Address entries referring to the item and index of an iteration handle, respectively. Append them to the address of the container.
+	static DataAddressEntry MakeIterationItemEntry(int handle);
+	static DataAddressEntry MakeIterationIndexEntry(int handle);
+
+	bool HasVariable(const String& variable_name) const;
+
+	// Variable ids let top-level variables be dirtied without looking up their name. An id is created on first request for the given name.
+	int GetVariableId(const String& variable_name);
+	void DirtyVariable(int variable_id);
+	bool IsVariableDirty(int variable_id) const;
+
 	void DirtyVariable(const String& variable_name);
 	bool IsVariableDirty(const String& variable_name) const;
 	void DirtyAllVariables();
@@ -83,11 +100,20 @@ public:
 	inline DataTypeRegister* GetDataTypeRegister() const { return data_type_register; }
 
 private:
+	DataVariable GetIterationVariable(DataVariable container, const DataAddressEntry& entry) const;
+
+	// Declared before the views, as these may release their iteration handles on destruction.
+	Vector<int> iteration_indices;
+	Vector<int> free_iteration_handles;
+
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
 
 	UnorderedMap<String, DataVariable> variables;
-	DirtyVariables dirty_variables;
+
+	UnorderedMap<String, int> variable_ids;
+	Vector<bool> dirty_variable_flags;
+	Vector<int> dirty_variable_ids;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
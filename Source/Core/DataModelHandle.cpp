@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
+#include "../../Include/RmlUi/Core/Log.h"
 #include "DataModel.h"
 
 namespace Rml {
@@ -48,6 +49,36 @@ void DataModelHandle::DirtyAllVariables()
 	model->DirtyAllVariables();
 }
 
+DataVariableHandle DataModelHandle::GetVariableHandle(const String& variable_name)
+{
+	if (!model->HasVariable(variable_name))
+	{
+		Log::Message(Log::LT_WARNING, "Could not get handle to data variable '%s', no variable by this name has been bound.", variable_name.c_str());
+		return DataVariableHandle();
+	}
+	return DataVariableHandle(model, model->GetVariableId(variable_name));
+}
+
+bool DataModelHandle::IsVariableDirty(DataVariableHandle variable)
+{
+	if (variable.model != model)
+	{
+		Log::Message(Log::LT_ERROR, "In IsVariableDirty: The variable handle is invalid or belongs to a different data model.");
+		return false;
+	}
+	return model->IsVariableDirty(variable.variable_id);
+}
+
+void DataModelHandle::DirtyVariable(DataVariableHandle variable)
+{
+	if (variable.model != model)
+	{
+		Log::Message(Log::LT_ERROR, "In DirtyVariable: The variable handle is invalid or belongs to a different data model.");
+		return;
+	}
+	model->DirtyVariable(variable.variable_id);
+}
+
 DataModelConstructor::DataModelConstructor() : model(nullptr), type_register(nullptr) {}
 
 DataModelConstructor::DataModelConstructor(DataModel* model) : model(model), type_register(model->GetDataTypeRegister())
@@ -28,6 +28,7 @@
 
 #include "DataView.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "DataModel.h"
 #include <algorithm>
 
 namespace Rml {
@@ -79,6 +80,7 @@ void DataViews::OnElementRemove(Element* element)
 		auto& view = *it;
 		if (view && view->GetElement() == element)
 		{
+			UnlinkView(view.get());
 			views_to_remove.push_back(std::move(view));
 			it = views.erase(it);
 		}
@@ -87,7 +89,7 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+bool DataViews::Update(DataModel& model, const Vector<int>& dirty_variable_ids)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
@@ -95,41 +97,58 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
 	// updated until the next Update() call.
-	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variable_ids.size()) && i < 10; i++)
 	{
-		num_dirty_variables_prev = dirty_variables.size();
+		// Only variables dirtied since the previous pass need to be visited.
+		const size_t num_dirty_variables_begin = num_dirty_variables_prev;
+		num_dirty_variables_prev = dirty_variable_ids.size();
 
-		Vector<DataView*> dirty_views;
+		update_generation += 1;
+		if (update_generation == 0)
+		{
+			for (const auto& view : views)
+				view->update_generation = 0;
+			update_generation = 1;
+		}
+
+		dirty_views.clear();
 
 		if (!views_to_add.empty())
 		{
 			views.reserve(views.size() + views_to_add.size());
 			for (auto&& view : views_to_add)
 			{
+				LinkView(model, view.get());
+				view->update_generation = update_generation;
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
 
 				views.push_back(std::move(view));
 			}
 			views_to_add.clear();
 		}
 
-		for (const String& variable_name : dirty_variables)
+		for (size_t j = num_dirty_variables_begin; j < num_dirty_variables_prev; j++)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
-		}
+			const int variable_id = dirty_variable_ids[j];
+			if (variable_id >= (int)variable_views.size())
+				continue;
 
-		// Remove duplicate entries
-		std::sort(dirty_views.begin(), dirty_views.end());
-		auto it_remove = std::unique(dirty_views.begin(), dirty_views.end());
-		dirty_views.erase(it_remove, dirty_views.end());
+			for (DataView::VariableLink* link = variable_views[variable_id]; link; link = link->next)
+			{
+				DataView* view = link->view;
+				if (view->update_generation != update_generation)
+				{
+					view->update_generation = update_generation;
+					dirty_views.push_back(view);
+				}
+			}
+		}
 
 		// Sort by the element's depth in the document tree so that any structural changes due to a changed variable are reflected in the element's
 		// children. Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
-		std::sort(dirty_views.begin(), dirty_views.end(), [](auto&& left, auto&& right) { return left->GetSortOrder() < right->GetSortOrder(); });
+		const auto sort_order_less = [](DataView* left, DataView* right) { return left->GetSortOrder() < right->GetSortOrder(); };
+		if (!std::is_sorted(dirty_views.begin(), dirty_views.end(), sort_order_less))
+			std::sort(dirty_views.begin(), dirty_views.end(), sort_order_less);
 
 		for (DataView* view : dirty_views)
 		{
@@ -141,26 +160,52 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 				result |= view->Update(model);
 		}
 
-		// Destroy views marked for destruction
-		// @performance: Horrible...
-		if (!views_to_remove.empty())
-		{
-			for (const auto& view : views_to_remove)
-			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end();)
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
-			}
-
-			views_to_remove.clear();
-		}
+		// Destroy views marked for destruction, they have already been unlinked from the variable lists.
+		views_to_remove.clear();
 	}
 
+	dirty_views.clear();
+
 	return result;
 }
 
+void DataViews::LinkView(DataModel& model, DataView* view)
+{
+	const StringList variable_names = view->GetVariableNameList();
+
+	// The links must not be reallocated while the view is linked.
+	RMLUI_ASSERT(view->variable_links.empty());
+	view->variable_links.resize(variable_names.size());
+
+	for (size_t i = 0; i < variable_names.size(); i++)
+	{
+		const int variable_id = model.GetVariableId(variable_names[i]);
+		if (variable_id >= (int)variable_views.size())
+			variable_views.resize(variable_id + 1, nullptr);
+
+		DataView::VariableLink*& head = variable_views[variable_id];
+		DataView::VariableLink& link = view->variable_links[i];
+		link = DataView::VariableLink{view, nullptr, head, variable_id};
+		if (head)
+			head->prev = &link;
+		head = &link;
+	}
+}
+
+void DataViews::UnlinkView(DataView* view)
+{
+	for (DataView::VariableLink& link : view->variable_links)
+	{
+		if (link.prev)
+			link.prev->next = link.next;
+		else
+			variable_views[link.variable_id] = link.next;
+
+		if (link.next)
+			link.next->prev = link.prev;
+	}
+
+	view->variable_links.clear();
+}
+
 } // namespace Rml
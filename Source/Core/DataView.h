@@ -99,8 +99,21 @@ protected:
 	DataView(Element* element, int sort_offset);
 
 private:
+	friend class DataViews;
+
+	// Links the view into the per-variable view lists of its owner, one link for each of its variable names.
+	struct VariableLink {
+		DataView* view;
+		VariableLink* prev;
+		VariableLink* next;
+		int variable_id;
+	};
+
 	ObserverPtr<Element> attached_element;
 	int sort_order;
+
+	Vector<VariableLink> variable_links;
+	uint32_t update_generation = 0;
 };
 
 class DataViews : NonCopyMoveable {
@@ -112,18 +125,27 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Updates the new views, and the views depending on the given (ids of) dirty variables. Any variables dirtied during the update are
+	// appended to the list, their views are then updated in the same call.
+	bool Update(DataModel& model, const Vector<int>& dirty_variable_ids);
 
 private:
 	using DataViewList = Vector<DataViewPtr>;
 
+	void LinkView(DataModel& model, DataView* view);
+	void UnlinkView(DataView* view);
+
 	DataViewList views;
 
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	// Head of the intrusive list of views for each variable id.
+	Vector<DataView::VariableLink*> variable_views;
+
+	// Incremented for each update pass, a view is collected at most once per pass.
+	uint32_t update_generation = 0;
+	Vector<DataView*> dirty_views;
 };
 
 } // namespace Rml
@@ -27,15 +27,19 @@
  */
 
 #include "DataViewDefault.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataExpression.h"
 #include "DataModel.h"
+#include "RmlNodeTree.h"
 #include "XMLParseTools.h"
 
 namespace Rml {
@@ -452,12 +456,59 @@ String DataViewText::BuildText() const
 	return result;
 }
 
+// Stands in for the items outside the visible range of virtual data-for views, and reports back to the view after being laid out.
+class ElementDataForSpacer final : public Element {
+public:
+	ElementDataForSpacer(const String& tag) : Element(tag) {}
+
+	DataViewFor* view = nullptr;
+
+protected:
+	void OnLayout() override
+	{
+		if (view)
+			view->OnViewportChange(true);
+	}
+
+	void GetRML(String& /*content*/) override {}
+};
+
+class DataViewForScrollListener final : public EventListener {
+public:
+	DataViewForScrollListener(DataViewFor* view) : view(view) {}
+
+	void ProcessEvent(Event& event) override
+	{
+		if (event.GetTargetElement() == event.GetCurrentElement())
+			view->OnViewportChange(false);
+	}
+
+private:
+	DataViewFor* view;
+};
+
+static ElementInstancerGeneric<ElementDataForSpacer> spacer_instancer;
+
+static void SetSpacerHeight(Element* spacer, float height)
+{
+	const Property height_property(Math::Max(height, 0.f), Unit::PX);
+	if (const Property* property = spacer->GetLocalProperty(PropertyId::Height))
+	{
+		if (*property == height_property)
+			return;
+	}
+	spacer->SetProperty(PropertyId::Height, height_property);
+}
+
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0) {}
 
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
 {
 	rml_contents = in_rml_content;
 
+	// Parse the contents only once, instead of for every new element.
+	rml_tree = RmlNodeTree::Parse(rml_contents);
+
 	StringList iterator_container_pair;
 	StringUtilities::ExpandString(iterator_container_pair, in_expression, ':');
 
@@ -501,17 +552,49 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (container_address.empty())
 		return false;
 
+	if (const Variant* key_attribute = element->GetAttribute("data-for-key"))
+	{
+		// The key must refer to the iterator variable, optionally followed by the address of one of its members, such as 'it.id'.
+		const String key_str = StringUtilities::StripWhitespace(key_attribute->Get<String>());
+		const DataAddress address = (key_str.empty() ? DataAddress() : DataModel::ParseAddress(key_str));
+		if (address.empty() || address.front().name != iterator_name)
+		{
+			Log::Message(Log::LT_WARNING, "Invalid data-for-key '%s', expected an address starting with the iterator name '%s'.", key_str.c_str(),
+				iterator_name.c_str());
+			return false;
+		}
+
+		key_address.assign(address.begin() + 1, address.end());
+		keyed = true;
+		data_model = &model;
+	}
+
+	if (const Variant* virtual_attribute = element->GetAttribute("data-for-virtual"))
+	{
+		// The attribute value sets the number of additional rows to instance on each side of the visible rows.
+		constexpr int default_overscan = 4;
+		overscan = Math::Max(FromString(virtual_attribute->Get<String>(), default_overscan), 0);
+		is_virtual = true;
+		data_model = &model;
+
+		if (keyed)
+		{
+			Log::Message(Log::LT_WARNING, "The data-for-key attribute is ignored in combination with data-for-virtual, in element %s.",
+				element->GetAddress().c_str());
+			keyed = false;
+		}
+	}
+
 	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
 
 	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
 	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+	for (auto it = attributes.begin(); it != attributes.end();)
 	{
-		if (it->first == "data-for")
-		{
-			attributes.erase(it);
-			break;
-		}
+		if (it->first == "data-for" || it->first == "data-for-key" || it->first == "data-for-virtual")
+			it = attributes.erase(it);
+		else
+			++it;
 	}
 
 	return true;
@@ -523,17 +606,19 @@ bool DataViewFor::Update(DataModel& model)
 	if (!variable)
 		return false;
 
+	if (keyed)
+		return UpdateKeyed(model, variable);
+	if (is_virtual)
+		return UpdateVirtual(model, variable);
+
 	bool result = false;
 	const int size = variable.Size();
 	const int num_elements = (int)elements.size();
-	Element* element = GetElement();
 
 	for (int i = 0; i < Math::Max(size, num_elements); i++)
 	{
 		if (i >= num_elements)
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
-
 			DataAddress iterator_address;
 			iterator_address.reserve(container_address.size() + 1);
 			iterator_address = container_address;
@@ -541,13 +626,7 @@ bool DataViewFor::Update(DataModel& model)
 
 			DataAddress iterator_index_address = {{"literal"}, {"int"}, {i}};
 
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
-
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
-
-			elements[i]->SetInnerRML(rml_contents);
+			elements.push_back(InstanceRow(model, std::move(iterator_address), std::move(iterator_index_address), GetElement()));
 
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
@@ -565,6 +644,244 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
+bool DataViewFor::UpdateKeyed(DataModel& model, DataVariable variable)
+{
+	const int size = variable.Size();
+	const int num_elements = (int)elements.size();
+
+	UnorderedMap<String, int> previous_rows;
+	previous_rows.reserve(num_elements);
+	for (int row = 0; row < num_elements; row++)
+		previous_rows.emplace(keys[row], row);
+
+	ElementList new_elements;
+	StringList new_keys;
+	Vector<int> new_handles;
+	new_elements.reserve(size);
+	new_keys.reserve(size);
+	new_handles.reserve(size);
+
+	Vector<bool> is_row_kept(num_elements, false);
+	ElementList instanced_elements;
+
+	for (int i = 0; i < size; i++)
+	{
+		DataVariable key_variable = variable.Child(DataAddressEntry(i));
+		for (size_t j = 0; j < key_address.size() && key_variable; j++)
+			key_variable = key_variable.Child(key_address[j]);
+
+		Variant key_value;
+		if (!key_variable || !key_variable.Get(key_value))
+			Log::Message(Log::LT_WARNING, "Could not get the data-for-key value of item %d in element %s.", i, GetElement()->GetAddress().c_str());
+		String key = key_value.Get<String>();
+
+		// Move the row of an existing key to its new index, only items with new keys need to construct a new row.
+		auto it = previous_rows.find(key);
+		if (it != previous_rows.end() && !is_row_kept[it->second])
+		{
+			const int row = it->second;
+			is_row_kept[row] = true;
+			model.SetIterationHandleIndex(handles[row], i);
+			new_elements.push_back(elements[row]);
+			new_handles.push_back(handles[row]);
+		}
+		else
+		{
+			const int handle = model.CreateIterationHandle(i);
+
+			DataAddress iterator_address;
+			iterator_address.reserve(container_address.size() + 1);
+			iterator_address = container_address;
+			iterator_address.push_back(DataModel::MakeIterationItemEntry(handle));
+
+			DataAddress iterator_index_address;
+			iterator_index_address.reserve(container_address.size() + 1);
+			iterator_index_address = container_address;
+			iterator_index_address.push_back(DataModel::MakeIterationIndexEntry(handle));
+
+			Element* new_element = InstanceRow(model, std::move(iterator_address), std::move(iterator_index_address), GetElement());
+			new_elements.push_back(new_element);
+			new_handles.push_back(handle);
+			instanced_elements.push_back(new_element);
+		}
+
+		new_keys.push_back(std::move(key));
+	}
+
+	// Remove the rows of deleted items. The remaining rows are followed by the newly instanced rows in the document.
+	ElementList document_order;
+	document_order.reserve(size);
+	for (int row = 0; row < num_elements; row++)
+	{
+		if (is_row_kept[row])
+		{
+			document_order.push_back(elements[row]);
+			continue;
+		}
+
+		model.EraseAliases(elements[row]);
+		elements[row]->GetParentNode()->RemoveChild(elements[row]).reset();
+		model.ReleaseIterationHandle(handles[row]);
+	}
+	document_order.insert(document_order.end(), instanced_elements.begin(), instanced_elements.end());
+
+	if (document_order != new_elements)
+		GetElement()->GetParentNode()->ReorderChildren(new_elements);
+
+	elements = std::move(new_elements);
+	keys = std::move(new_keys);
+	handles = std::move(new_handles);
+
+	return false;
+}
+
+bool DataViewFor::UpdateVirtual(DataModel& model, DataVariable variable)
+{
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	if (!spacer_before)
+	{
+		// The rows are placed between the two spacers, all in front of the data-for element. The parent acts as the scroll container.
+		for (ObserverPtr<Element>* spacer : {&spacer_before, &spacer_after})
+		{
+			ElementPtr spacer_ptr = spacer_instancer.InstanceElement(parent, "#spacer", XMLAttributes());
+			spacer_ptr->SetInstancer(&spacer_instancer);
+			spacer_ptr->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+			*spacer = parent->InsertBefore(std::move(spacer_ptr), element)->GetObserverPtr();
+		}
+
+		// The last spacer is laid out after all the rows, at which point they can be measured.
+		static_cast<ElementDataForSpacer*>(spacer_after.get())->view = this;
+
+		scroll_listener = MakeUnique<DataViewForScrollListener>(this);
+		parent->AddEventListener(EventId::Scroll, scroll_listener.get());
+		scroll_container = parent->GetObserverPtr();
+	}
+
+	const int size = variable.Size();
+	int first = 0, last = 0;
+	GetVirtualRange(size, first, last);
+	const int num_rows = last - first;
+
+	while ((int)elements.size() > num_rows)
+	{
+		model.EraseAliases(elements.back());
+		parent->RemoveChild(elements.back()).reset();
+		model.ReleaseIterationHandle(handles.back());
+		elements.pop_back();
+		handles.pop_back();
+	}
+
+	// Recycle the existing rows for the new range, and only instance new rows when the range has grown.
+	for (int i = 0; i < (int)elements.size(); i++)
+		model.SetIterationHandleIndex(handles[i], first + i);
+
+	for (int i = (int)elements.size(); i < num_rows; i++)
+	{
+		const int handle = model.CreateIterationHandle(first + i);
+
+		DataAddress iterator_address;
+		iterator_address.reserve(container_address.size() + 1);
+		iterator_address = container_address;
+		iterator_address.push_back(DataModel::MakeIterationItemEntry(handle));
+
+		DataAddress iterator_index_address;
+		iterator_index_address.reserve(container_address.size() + 1);
+		iterator_index_address = container_address;
+		iterator_index_address.push_back(DataModel::MakeIterationIndexEntry(handle));
+
+		elements.push_back(InstanceRow(model, std::move(iterator_address), std::move(iterator_index_address), spacer_after.get()));
+		handles.push_back(handle);
+	}
+
+	virtual_first = first;
+	spacer_row_height = row_height;
+	SetSpacerHeight(spacer_before.get(), float(first) * row_height);
+	SetSpacerHeight(spacer_after.get(), float(size - last) * row_height);
+
+	return false;
+}
+
+void DataViewFor::GetVirtualRange(int size, int& out_first, int& out_last)
+{
+	Element* container = scroll_container.get();
+	Element* spacer = spacer_before.get();
+
+	if (row_height <= 0.f || !container || !spacer)
+	{
+		// Without any rows to measure yet, start with a few rows from the beginning.
+		out_first = 0;
+		out_last = Math::Min(size, overscan + 1);
+		return;
+	}
+
+	// Find the viewport of the scroll container relative to the top of the rows, this is where the first spacer starts.
+	const float viewport_top = container->GetAbsoluteOffset(BoxArea::Padding).y - spacer->GetAbsoluteOffset(BoxArea::Border).y;
+	const float viewport_bottom = viewport_top + container->GetClientHeight();
+
+	out_first = Math::Clamp(Math::RoundDownToInteger(viewport_top / row_height) - overscan, 0, size);
+	out_last = Math::Clamp(Math::RoundUpToInteger(viewport_bottom / row_height) + overscan, out_first, size);
+}
+
+void DataViewFor::OnViewportChange(bool measure_rows)
+{
+	Element* spacer = spacer_before.get();
+	if (!data_model || !spacer || !spacer_after)
+		return;
+
+	if (measure_rows && !elements.empty())
+	{
+		// Rows are assumed to be of uniform height, including their margins, estimate it from the distance between the first and last rows.
+		Element* first_row = elements.front();
+		Element* last_row = elements.back();
+		if (elements.size() >= 2)
+		{
+			const float distance = last_row->GetAbsoluteOffset(BoxArea::Border).y - first_row->GetAbsoluteOffset(BoxArea::Border).y;
+			row_height = Math::Max(distance / float(elements.size() - 1), 0.f);
+		}
+		else
+		{
+			// Vertical margins between adjacent rows collapse, thus only the larger one is counted.
+			const Box& box = first_row->GetBox();
+			const float margin = Math::Max(box.GetEdge(BoxArea::Margin, BoxEdge::Top), box.GetEdge(BoxArea::Margin, BoxEdge::Bottom));
+			row_height = box.GetSize(BoxArea::Border).y + margin;
+		}
+	}
+
+	DataVariable variable = data_model->GetVariable(container_address);
+	if (!variable)
+		return;
+
+	int first = 0, last = 0;
+	GetVirtualRange(variable.Size(), first, last);
+
+	const bool range_changed = (first != virtual_first || last - first != (int)elements.size());
+	const bool spacers_changed = (Math::Absolute(row_height - spacer_row_height) >= 0.5f);
+	if (range_changed || spacers_changed)
+	{
+		data_model->DirtyVariable(container_address.front().name);
+		if (Context* context = GetElement()->GetContext())
+			context->RequestNextUpdate(0);
+	}
+}
+
+Element* DataViewFor::InstanceRow(DataModel& model, DataAddress iterator_address, DataAddress iterator_index_address, Element* insert_before)
+{
+	Element* element = GetElement();
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
+	model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), insert_before);
+
+	if (!rml_tree || !rml_tree->Instance(new_element))
+		new_element->SetInnerRML(rml_contents);
+
+	return new_element;
+}
+
 StringList DataViewFor::GetVariableNameList() const
 {
 	RMLUI_ASSERT(!container_address.empty());
@@ -573,6 +890,27 @@ StringList DataViewFor::GetVariableNameList() const
 
 void DataViewFor::Release()
 {
+	if (scroll_listener && scroll_container)
+		scroll_container->RemoveEventListener(EventId::Scroll, scroll_listener.get());
+
+	if (Element* spacer = spacer_after.get())
+		static_cast<ElementDataForSpacer*>(spacer)->view = nullptr;
+
+	// The spacers are owned by the parent rather than the data-for element, remove them along with the view.
+	for (ObserverPtr<Element>* spacer : {&spacer_before, &spacer_after})
+	{
+		if (Element* spacer_element = spacer->get())
+		{
+			if (Element* parent = spacer_element->GetParentNode())
+				parent->RemoveChild(spacer_element);
+		}
+	}
+
+	if (data_model)
+	{
+		for (int handle : handles)
+			data_model->ReleaseIterationHandle(handle);
+	}
 	delete this;
 }
 
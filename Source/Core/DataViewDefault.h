@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_DATAVIEWDEFAULT_H
 #define RMLUI_CORE_DATAVIEWDEFAULT_H
 
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Variant.h"
@@ -38,6 +39,8 @@ namespace Rml {
 
 class Element;
 class DataExpression;
+class DataVariable;
+class RmlNodeTree;
 using DataExpressionPtr = UniquePtr<DataExpression>;
 
 class DataViewCommon : public DataView {
@@ -160,17 +163,46 @@ public:
 
 	StringList GetVariableNameList() const override;
 
+	// Virtual rows only: Called when the viewport of the scroll container may have changed, optionally measuring the rows again after layout.
+	void OnViewportChange(bool measure_rows);
+
 protected:
 	void Release() override;
 
 private:
+	// Rows are matched to the container items by key when 'data-for-key' is set, otherwise by index.
+	bool UpdateKeyed(DataModel& model, DataVariable variable);
+	// Rows are only instanced for the visible items when 'data-for-virtual' is set.
+	bool UpdateVirtual(DataModel& model, DataVariable variable);
+	void GetVirtualRange(int size, int& out_first, int& out_last);
+	Element* InstanceRow(DataModel& model, DataAddress iterator_address, DataAddress iterator_index_address, Element* insert_before);
+
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
+	UniquePtr<RmlNodeTree> rml_tree;
 	ElementAttributes attributes;
 
 	ElementList elements;
+
+	// Keyed and virtual rows only: The key address relative to each item, and the key and iteration handle of each row.
+	bool keyed = false;
+	DataAddress key_address;
+	StringList keys;
+	Vector<int> handles;
+	DataModel* data_model = nullptr;
+
+	// Virtual rows only: The rows cover the items starting at the first index, and the spacers stand in for the items before and after them.
+	bool is_virtual = false;
+	int overscan = 0;
+	int virtual_first = 0;
+	float row_height = 0;
+	float spacer_row_height = 0;
+	ObserverPtr<Element> scroll_container;
+	ObserverPtr<Element> spacer_before;
+	ObserverPtr<Element> spacer_after;
+	UniquePtr<EventListener> scroll_listener;
 };
 
 class DataViewAlias final : public DataView {
@@ -81,6 +81,12 @@ void DecoratorTiled::Tile::CalculateDimensions(const Texture& texture) const
 
 			tile_data.texcoords[0] = position / texture_dimensions;
 			tile_data.texcoords[1] = size_relative + tile_data.texcoords[0];
+
+			// Map the texture coordinates into the texture's region of its atlas page, if any.
+			const Rectanglef tex_coord_region = texture.GetTexCoordRegion();
+			for (Vector2f& texcoord : tile_data.texcoords)
+				texcoord = tex_coord_region.TopLeft() + texcoord * tex_coord_region.Size();
+			tile_data.premultiplied = texture.IsInAtlas();
 		}
 	}
 }
@@ -111,6 +117,12 @@ void DecoratorTiled::Tile::GenerateGeometry(Vector<Vertex>& vertices, Vector<int
 	if (!tile_data_calculated)
 		return;
 
+	if (tile_data.premultiplied)
+	{
+		const float alpha = (float)quad_colour.alpha / 255.f;
+		quad_colour = Colourb((byte)(alpha * quad_colour.red), (byte)(alpha * quad_colour.green), (byte)(alpha * quad_colour.blue), quad_colour.alpha);
+	}
+
 	// Generate the oriented texture coordinates for the tiles.
 	Vector2f scaled_texcoords[2];
 	for (int i = 0; i < 2; i++)
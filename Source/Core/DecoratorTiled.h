@@ -100,6 +100,7 @@ public:
 		struct TileData {
 			Vector2f size;         // 'px' units
 			Vector2f texcoords[2]; // relative units
+			bool premultiplied;    // true for textures packed into an atlas page
 		};
 
 		int texture_index;
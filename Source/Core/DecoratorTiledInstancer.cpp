@@ -182,6 +182,12 @@ bool DecoratorTiledInstancer::GetTileProperties(DecoratorTiled::Tile* tiles, Tex
 			const Property& orientation_property = *properties.GetProperty(ids.orientation);
 			tile.orientation = (DecoratorTiled::TileOrientation)orientation_property.value.Get<int>();
 		}
+
+		// Images can be packed into a texture atlas, unless they are repeated by wrapping their texture coordinates.
+		const bool repeat = (tile.fit_mode == DecoratorTiled::TileFitMode::REPEAT || tile.fit_mode == DecoratorTiled::TileFitMode::REPEAT_X ||
+			tile.fit_mode == DecoratorTiled::TileFitMode::REPEAT_Y);
+		if (!sprite && !repeat)
+			texture.AllowAtlas();
 	}
 
 	return true;
@@ -42,6 +42,8 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
+#include "AtomTable.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -49,13 +51,17 @@
 #include "ElementBackgroundBorder.h"
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "ElementLayer.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "Layout/LayoutCache.h"
 #include "Layout/LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
 #include "PropertiesIterator.h"
+#include "RenderCommandList.h"
+#include "StyleSharingCache.h"
 #include "StyleSheetNode.h"
 #include "StyleSheetParser.h"
 #include "TransformState.h"
@@ -100,14 +106,45 @@ struct ElementMeta {
 	ElementDecoration decoration;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+
+	// The clipping region applied to elements offset from this element, valid during the given render pass.
+	Rectanglei offset_children_clip;
+	unsigned int offset_children_clip_pass = 0;
+
+	// The screen-space bounds of the geometry rendered by this element when dirty regions were last tracked.
+	Rectanglef render_region = Rectanglef::MakeInvalid();
+
+	// The cached rendering of this element and its stacking context, only set for elements with 'layer: cached'.
+	UniquePtr<ElementLayer> layer;
 };
 
 static Pool<ElementMeta> element_meta_chunk_pool(200, true);
 
+// Incremented for each render pass, the first pass is one so that cached clipping regions of new elements are invalid.
+static unsigned int render_pass = 1;
+
+// Activates the given clipping region on the context, an invalid region disables clipping.
+static void SetActiveClipRegion(Context* context, Rectanglei clip)
+{
+	Vector2i current_origin, current_dimensions;
+	const bool current_clip = context->GetActiveClipRegion(current_origin, current_dimensions);
+	const bool clip_enabled = clip.Valid();
+
+	if (current_clip != clip_enabled || (clip_enabled && (clip.Position() != current_origin || clip.Size() != current_dimensions)))
+	{
+		if (clip_enabled)
+			context->SetActiveClipRegion(clip.Position(), clip.Size());
+		else
+			context->SetActiveClipRegion(Vector2i(-1, -1), Vector2i(-1, -1));
+		ElementUtilities::ApplyActiveClipRegion(context);
+	}
+}
+
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
 	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_animation(false),
-	dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0),
+	dirty_transition(false), dirty_transform(false), dirty_perspective(false), layout_boundary(false),
+	stacking_context_clip_contained(false), render_region_dirty(false), tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0),
 	absolute_offset(0, 0), scroll_offset(0, 0)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
@@ -179,8 +216,16 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->decoration.InstanceDecorators();
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	if (!children.empty())
+	{
+		// Make our names available to the ancestor filter while resolving the definitions of our descendants, and let our children share styles.
+		AncestorFilter::PushParent(this);
+		StyleSharingCache::PushParent(this);
+		for (size_t i = 0; i < children.size(); i++)
+			children[i]->Update(dp_ratio, vp_dimensions);
+		StyleSharingCache::PopParent();
+		AncestorFilter::PopParent();
+	}
 
 	if (!animations.empty() && IsVisible(true))
 	{
@@ -230,12 +275,33 @@ void Element::Render()
 
 	UpdateTransformState();
 
-	// Apply our transform
-	ElementUtilities::ApplyTransform(*this);
+	// Find the clipping region of this element, and skip rendering the element if it lies completely outside the region. The clipping regions
+	// are built incrementally from the cached regions of the offset parents.
+	Context* context = GetContext();
+	const Rectanglei clip = (context ? GetRenderClip() : Rectanglei::MakeInvalid());
+	const bool clipped_away = (clip.Valid() && IsOutsideRenderClip(clip));
+
+	// When the context tracks dirty regions, the bounds of our rendered geometry are collected from the recorded commands.
+	const bool recording = (context && RenderCommandList::GetRecordingInterface());
+	RenderCommandList* region_tracker = (recording && context->dirty_regions_enabled ? context->render_commands.get() : nullptr);
 
-	// Set up the clipping region for this element.
-	if (ElementUtilities::SetClippingRegion(this))
+	if (context && !clipped_away)
 	{
+		// Apply our transform
+		ElementUtilities::ApplyTransform(*this);
+
+		SetActiveClipRegion(context, clip);
+
+		if (region_tracker)
+			region_tracker->BeginBounds();
+
+		if (meta->layer && RenderLayer(context, clip))
+		{
+			if (region_tracker)
+				UpdateRenderRegion(context, region_tracker->EndBounds());
+			return;
+		}
+
 		meta->background_border.Render(this);
 		meta->decoration.RenderDecorators();
 
@@ -244,6 +310,38 @@ void Element::Render()
 
 			OnRender();
 		}
+
+		if (region_tracker)
+			UpdateRenderRegion(context, region_tracker->EndBounds());
+	}
+	else if (region_tracker)
+	{
+		UpdateRenderRegion(context, Rectanglef::MakeInvalid());
+	}
+
+	if (clipped_away && stacking_context_clip_contained)
+	{
+		// Our stacking context can be skipped as well if all of its elements are bound by the clipping region of our offset children, and that
+		// region is empty. This requires that the elements are offset from us or our descendants.
+		using Style::Display;
+		const Display display = GetDisplay();
+		const bool contains_offset_children = (display != Display::Inline && display != Display::TableRow && display != Display::TableRowGroup &&
+			display != Display::TableColumn && display != Display::TableColumnGroup);
+
+		if (contains_offset_children)
+		{
+			const Rectanglei children_clip = GetRenderClipForOffsetChildren();
+			if (children_clip.Valid() && (children_clip.Width() <= 0 || children_clip.Height() <= 0))
+			{
+				// The skipped elements no longer render anything, make sure the areas they previously covered are redrawn.
+				if (region_tracker)
+				{
+					for (Element* element : stacking_context)
+						element->ReleaseRenderRegion(context, false);
+				}
+				return;
+			}
+		}
 	}
 
 	// Render all elements in our local stacking context.
@@ -290,8 +388,9 @@ ElementPtr Element::Clone() const
 
 void Element::SetClass(const String& class_name, bool activate)
 {
+	// Classes are not interned, those not used by any style sheet can't affect any definitions.
 	if (meta->style.SetClass(class_name, activate))
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		DirtyDefinitionOnToggle(AtomTable::Find(class_name), false);
 }
 
 bool Element::IsClassSet(const String& class_name) const
@@ -342,7 +441,7 @@ String Element::GetAddress(bool include_pseudo_classes, bool include_parents) co
 		for (auto& pseudo_class : pseudo_classes)
 		{
 			address += ":";
-			address += pseudo_class.first;
+			address += AtomTable::GetName(pseudo_class.first);
 		}
 	}
 
@@ -444,6 +543,12 @@ void Element::SetBox(const Box& box)
 		main_box = box;
 		additional_boxes.clear();
 
+		DirtyRender();
+
+		// The box may be set from outside the layout engine, then any stored formatting no longer reflects the element's layout.
+		if (layout_cache)
+			layout_cache->valid = false;
+
 		OnResize();
 
 		meta->background_border.DirtyBackground();
@@ -456,6 +561,8 @@ void Element::AddBox(const Box& box, Vector2f offset)
 {
 	additional_boxes.emplace_back(PositionedBox{box, offset});
 
+	DirtyRender();
+
 	OnResize();
 
 	meta->background_border.DirtyBackground();
@@ -730,10 +837,10 @@ PropertiesIteratorView Element::IterateLocalProperties() const
 
 void Element::SetPseudoClass(const String& pseudo_class, bool activate)
 {
-	if (meta->style.SetPseudoClass(pseudo_class, activate, false))
+	const Atom pseudo_class_atom = (activate ? AtomTable::GetOrCreate(pseudo_class) : AtomTable::Find(pseudo_class));
+	if (meta->style.SetPseudoClass(pseudo_class_atom, activate, false))
 	{
-		// Include siblings in case of RCSS presence of sibling combinators '+', '~'.
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		DirtyDefinitionOnToggle(pseudo_class_atom, true);
 		OnPseudoClassChange(pseudo_class, activate);
 	}
 }
@@ -761,7 +868,7 @@ StringList Element::GetActivePseudoClasses() const
 	names.reserve(pseudo_classes.size());
 	for (auto& pseudo_class : pseudo_classes)
 	{
-		names.push_back(pseudo_class.first);
+		names.push_back(AtomTable::GetName(pseudo_class.first));
 	}
 
 	return names;
@@ -1419,6 +1526,51 @@ ElementPtr Element::RemoveChild(Element* child)
 	return nullptr;
 }
 
+void Element::ReorderChildren(const ElementList& ordered_children)
+{
+	using ChildPair = Pair<Element*, ElementPtr>;
+	auto ChildPairLess = [](const ChildPair& a, const ChildPair& b) { return a.first < b.first; };
+
+	ElementList sorted_children = ordered_children;
+	std::sort(sorted_children.begin(), sorted_children.end());
+
+	// Take out the given children, while remembering the positions they occupied.
+	Vector<size_t> positions;
+	Vector<ChildPair> taken_children;
+	positions.reserve(ordered_children.size());
+	taken_children.reserve(ordered_children.size());
+
+	for (size_t i = 0; i < children.size(); i++)
+	{
+		Element* child = children[i].get();
+		if (std::binary_search(sorted_children.begin(), sorted_children.end(), child))
+		{
+			positions.push_back(i);
+			taken_children.emplace_back(child, std::move(children[i]));
+		}
+	}
+
+	if (positions.size() != ordered_children.size())
+	{
+		RMLUI_ERRORMSG("All elements to reorder must be unique children of this element.");
+		for (size_t i = 0; i < taken_children.size(); i++)
+			children[positions[i]] = std::move(taken_children[i].second);
+		return;
+	}
+
+	std::sort(taken_children.begin(), taken_children.end(), ChildPairLess);
+
+	for (size_t i = 0; i < taken_children.size(); i++)
+	{
+		auto it = std::lower_bound(taken_children.begin(), taken_children.end(), ChildPair(ordered_children[i], nullptr), ChildPairLess);
+		children[positions[i]] = std::move(it->second);
+	}
+
+	DirtyLayout();
+	DirtyStackingContext();
+	DirtyDefinition(DirtyNodes::Self);
+}
+
 bool Element::HasChildNodes() const
 {
 	return (int)children.size() > num_non_dom_children;
@@ -1584,6 +1736,8 @@ void Element::OnStyleSheetChange() {}
 
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	DirtyRender();
+
 	for (const auto& element_attribute : changed_attributes)
 	{
 		const auto& attribute = element_attribute.first;
@@ -1591,6 +1745,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		if (attribute == "id")
 		{
 			id = value.Get<String>();
+			meta->style.SetId(id);
 		}
 		else if (attribute == "class")
 		{
@@ -1655,6 +1810,9 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
+
+	DirtyRender();
+
 	const bool top_right_bottom_left_changed = (           //
 		changed_properties.Contains(PropertyId::Top) ||    //
 		changed_properties.Contains(PropertyId::Right) ||  //
@@ -1691,6 +1849,14 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		}
 	}
 
+	// The position and clip properties affect the render order and clipping of the stacking context.
+	if (changed_properties.Contains(PropertyId::Position) || changed_properties.Contains(PropertyId::Clip))
+	{
+		DirtyStackingContext();
+		if (parent)
+			parent->DirtyStackingContext();
+	}
+
 	// Update the position.
 	if (top_right_bottom_left_changed)
 	{
@@ -1712,7 +1878,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 				parent->DirtyStackingContext();
 
 			if (!visible)
+			{
 				Blur();
+
+				// Neither this element nor its descendants are rendered anymore, make sure their previous areas are redrawn.
+				if (Context* context = GetContext())
+					ReleaseRenderRegion(context, true);
+			}
 		}
 	}
 
@@ -1723,7 +1895,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 
 		if (z_index_property.type == Style::ZIndex::Auto)
 		{
-			if (local_stacking_context && !local_stacking_context_forced)
+			if (local_stacking_context && !local_stacking_context_forced && !meta->layer)
 			{
 				// We're no longer acting as a stacking context.
 				local_stacking_context = false;
@@ -1759,6 +1931,38 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		}
 	}
 
+	// Update the cached layer, it acts as a stacking context so that it contains all of our descendants.
+	if (changed_properties.Contains(PropertyId::Layer))
+	{
+		if (meta->computed_values.layer() == Style::Layer::Cached)
+		{
+			if (!meta->layer)
+				meta->layer = MakeUnique<ElementLayer>();
+
+			if (!local_stacking_context)
+			{
+				local_stacking_context = true;
+				stacking_context_dirty = true;
+				if (parent != nullptr)
+					parent->DirtyStackingContext();
+			}
+		}
+		else
+		{
+			meta->layer.reset();
+
+			if (local_stacking_context && !local_stacking_context_forced && meta->computed_values.z_index().type == Style::ZIndex::Auto)
+			{
+				local_stacking_context = false;
+
+				stacking_context_dirty = false;
+				stacking_context.clear();
+				if (parent != nullptr)
+					parent->DirtyStackingContext();
+			}
+		}
+	}
+
 	const bool border_radius_changed = (                                    //
 		changed_properties.Contains(PropertyId::BorderTopLeftRadius) ||     //
 		changed_properties.Contains(PropertyId::BorderTopRightRadius) ||    //
@@ -1841,8 +2045,29 @@ void Element::OnChildRemove(Element* /*child*/) {}
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	// The stored formatting of this element and all its ancestors may have changed.
+	for (Element* element = this; element; element = element->parent)
+	{
+		if (element->layout_cache)
+			element->layout_cache->valid = false;
+	}
+
+	ElementDocument* document = GetOwnerDocument();
+	if (!document || document->IsLayoutDirty())
+		return;
+
+	// Changes to this element can affect the layout of its parent, but nothing outside the nearest layout boundary among our ancestors. Then only
+	// that boundary needs to be formatted again.
+	for (Element* ancestor = parent; ancestor && ancestor != document; ancestor = ancestor->parent)
+	{
+		if (ancestor->layout_boundary)
+		{
+			document->DirtyLayoutBoundary(ancestor);
+			return;
+		}
+	}
+
+	document->DirtyLayout();
 }
 
 bool Element::IsLayoutDirty()
@@ -1907,6 +2132,14 @@ const Style::ComputedValues& Element::GetComputedValues() const
 	return meta->computed_values;
 }
 
+void Element::DirtyRender()
+{
+	render_region_dirty = true;
+	DirtyLayer();
+	if (Context* context = GetContext())
+		context->render_dirty = true;
+}
+
 void Element::GetRML(String& content)
 {
 	// First we start the open tag, add the attributes then close the open tag.
@@ -1951,7 +2184,11 @@ void Element::SetOwnerDocument(ElementDocument* document)
 	{
 		// We are detaching from the document and thereby also the context.
 		if (Context* context = owner_document->GetContext())
+		{
+			// Descendants are detached separately below, except for those of documents which remain owned by their document.
+			ReleaseRenderRegion(context, owner_document == this);
 			context->OnElementDetach(this);
+		}
 	}
 
 	// If this element is a document, then never change owner_document.
@@ -2043,6 +2280,12 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	// The offset may change for elements which are not rendered, and thus still have their absolute offset dirtied. The affected regions are
+	// found when the elements are rendered again.
+	DirtyLayer();
+	if (Context* context = GetContext())
+		context->render_dirty = true;
+
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
@@ -2191,6 +2434,27 @@ void Element::BuildLocalStackingContext()
 	stacking_context.resize(stacking_children.size());
 	for (size_t i = 0; i < stacking_children.size(); i++)
 		stacking_context[i] = stacking_children[i].element;
+
+	// Determine whether the elements of the stacking context are always clipped by the clipping region of our offset children. Elements which
+	// are fixed, absolutely positioned relative to our ancestors, ignore clipping regions, or contain their own stacking context, may escape it.
+	// Our scrollbars ignore our own clipping region but stay within our border box.
+	using Style::Clip;
+	using Style::Position;
+	const bool positioned = (GetPosition() != Position::Static);
+	const auto is_non_dom_child = [this](const Element* element) {
+		if (element->parent != this)
+			return false;
+		const auto it_non_dom_begin = children.end() - num_non_dom_children;
+		return std::any_of(it_non_dom_begin, children.end(), [element](const ElementPtr& child) { return child.get() == element; });
+	};
+
+	stacking_context_clip_contained = std::all_of(stacking_context.begin(), stacking_context.end(), [&](Element* element) {
+		const ComputedValues& computed = element->GetComputedValues();
+		const Clip clip = computed.clip();
+		const Position position = computed.position();
+		const bool clip_contained = (!(clip == Clip::Type::None) && (clip.GetNumber() == 0 || (clip.GetNumber() == 1 && is_non_dom_child(element))));
+		return clip_contained && !element->local_stacking_context && position != Position::Fixed && (positioned || position != Position::Absolute);
+	});
 }
 
 void Element::AddChildrenToStackingContext(Vector<StackingContextChild>& stacking_children)
@@ -2302,6 +2566,10 @@ void Element::AddToStackingContext(Vector<StackingContextChild>& stacking_childr
 
 void Element::DirtyStackingContext()
 {
+	DirtyLayer();
+	if (Context* context = GetContext())
+		context->render_dirty = true;
+
 	// Find the first ancestor that has a local stacking context, that is our stacking context parent.
 	Element* stacking_context_parent = this;
 	while (stacking_context_parent && !stacking_context_parent->local_stacking_context)
@@ -2313,30 +2581,289 @@ void Element::DirtyStackingContext()
 		stacking_context_parent->stacking_context_dirty = true;
 }
 
+Rectanglei Element::GetRenderClip()
+{
+	using Style::Clip;
+	const Clip clip = meta->computed_values.clip();
+	if (clip == Clip::Type::None)
+		return Rectanglei::MakeInvalid();
+
+	// Climb past the clipping regions ignored by this element, as specified by its 'clip' property. Once no more regions are ignored, the
+	// remaining region is given by the cached region of the current offset parent.
+	int num_ignored_clips = clip.GetNumber();
+	Element* clipping_element = offset_parent;
+
+	while (clipping_element && num_ignored_clips > 0)
+	{
+		const ComputedValues& clip_computed = clipping_element->GetComputedValues();
+		const bool clip_enabled = (clip_computed.overflow_x() != Style::Overflow::Visible || clip_computed.overflow_y() != Style::Overflow::Visible);
+
+		if (clip_enabled)
+			num_ignored_clips--;
+
+		num_ignored_clips = Math::Max(num_ignored_clips, clip_computed.clip().GetNumber());
+
+		if (clip_computed.clip() == Clip::Type::None)
+			return Rectanglei::MakeInvalid();
+
+		clipping_element = clipping_element->offset_parent;
+	}
+
+	if (!clipping_element)
+		return Rectanglei::MakeInvalid();
+
+	return clipping_element->GetRenderClipForOffsetChildren();
+}
+
+Rectanglei Element::GetRenderClipForOffsetChildren()
+{
+	if (meta->offset_children_clip_pass == render_pass)
+		return meta->offset_children_clip;
+
+	using Style::Clip;
+	const ComputedValues& computed = meta->computed_values;
+	const bool clip_enabled = (computed.overflow_x() != Style::Overflow::Visible || computed.overflow_y() != Style::Overflow::Visible);
+	const bool clip_always = (computed.clip() == Clip::Type::Always);
+
+	Rectanglei clip = Rectanglei::MakeInvalid();
+
+	// Only elements with overflowing content clip it, unless always clipping.
+	if (clip_always ||
+		(clip_enabled && (GetClientWidth() < GetScrollWidth() - 0.5f || GetClientHeight() < GetScrollHeight() - 0.5f)))
+	{
+		Vector2f origin = GetAbsoluteOffset(client_area);
+		Vector2f dimensions = GetBox().GetSize(client_area);
+		Math::SnapToPixelGrid(origin, dimensions);
+		clip = Rectanglei::FromPositionSize(Vector2i(origin), Vector2i(dimensions));
+	}
+
+	// This element behaves as our offset children when combining the clipping regions of its offset ancestors, unless it ignores them.
+	if (!(computed.clip() == Clip::Type::None))
+		clip.IntersectIfValid(GetRenderClip());
+
+	meta->offset_children_clip = clip;
+	meta->offset_children_clip_pass = render_pass;
+
+	return clip;
+}
+
+bool Element::IsOutsideRenderClip(Rectanglei clip)
+{
+	const Vector2f position = GetAbsoluteOffset(BoxArea::Border);
+
+	Rectanglef bounds = Rectanglef::MakeInvalid();
+	for (int i = 0; i < GetNumBoxes(); i++)
+	{
+		Vector2f box_offset;
+		const Box& box = GetBox(i, box_offset);
+		const Rectanglef box_bounds = Rectanglef::FromPositionSize(position + box_offset, box.GetSize(BoxArea::Border));
+		if (bounds.Valid())
+			bounds.Join(box_bounds);
+		else
+			bounds = box_bounds;
+	}
+
+	// Elements without an area, such as text elements, may render content outside their box.
+	if (!bounds.Valid() || bounds.Width() <= 0.f || bounds.Height() <= 0.f)
+		return false;
+
+	if (const Matrix4f* transform = (transform_state ? transform_state->GetTransform() : nullptr))
+	{
+		const Vector2f corners[4] = {bounds.TopLeft(), {bounds.Right(), bounds.Top()}, {bounds.Left(), bounds.Bottom()}, bounds.BottomRight()};
+
+		bounds = Rectanglef::MakeInvalid();
+		for (Vector2f corner : corners)
+		{
+			const Vector4f projected = *transform * Vector4f(corner.x, corner.y, 0, 1);
+
+			// Points behind the viewer can't be reliably bounded.
+			if (projected.w <= 0.f)
+				return false;
+
+			const Vector3f point = projected.PerspectiveDivide();
+			if (bounds.Valid())
+				bounds.Join(Vector2f(point.x, point.y));
+			else
+				bounds = Rectanglef::FromPosition(Vector2f(point.x, point.y));
+		}
+	}
+
+	return !bounds.Intersects(Rectanglef(clip));
+}
+
+void Element::BeginRenderPass()
+{
+	render_pass += 1;
+	if (render_pass == 0)
+		render_pass = 1;
+}
+
+void Element::UpdateRenderRegion(Context* context, Rectanglef region)
+{
+	Rectanglef& previous_region = meta->render_region;
+
+	const bool region_changed = (region.Valid() != previous_region.Valid() || (region.Valid() && !(region == previous_region)));
+
+	if (render_region_dirty || region_changed)
+	{
+		if (previous_region.Valid())
+			context->AddDirtyRegion(previous_region);
+		if (region.Valid() && region_changed)
+			context->AddDirtyRegion(region);
+	}
+
+	previous_region = region;
+	render_region_dirty = false;
+}
+
+void Element::ReleaseRenderRegion(Context* context, bool recursive)
+{
+	if (!context->dirty_regions_enabled)
+		return;
+
+	if (meta->render_region.Valid())
+	{
+		context->AddDirtyRegion(meta->render_region);
+		meta->render_region = Rectanglef::MakeInvalid();
+	}
+
+	if (recursive)
+	{
+		for (int i = 0; i < GetNumChildren(true); i++)
+			GetChild(i)->ReleaseRenderRegion(context, true);
+	}
+}
+
+bool Element::RenderLayer(Context* context, Rectanglei clip)
+{
+	// Layers are rendered in context coordinates, thus they cannot be used within transforms.
+	if (transform_state && transform_state->GetTransform())
+		return false;
+
+	// Content outside our border box is not part of the layer.
+	const Vector2f border_position = GetAbsoluteOffset(BoxArea::Border);
+	const Vector2f border_size = GetBox().GetSize(BoxArea::Border);
+	Rectanglei region = Rectanglei::FromCorners(
+		Vector2i(Math::RoundDownToInteger(border_position.x), Math::RoundDownToInteger(border_position.y)),
+		Vector2i(Math::RoundUpToInteger(border_position.x + border_size.x), Math::RoundUpToInteger(border_position.y + border_size.y)));
+
+	region.Intersect(Rectanglei::FromSize(context->GetDimensions()));
+	if (clip.Valid())
+		region.Intersect(clip);
+
+	if (region.Width() <= 0 || region.Height() <= 0)
+		return true;
+
+	ElementLayer& layer = *meta->layer;
+
+	if (layer.IsDirty(region))
+	{
+		// Render targets are created and rendered into directly, bypassing any recording of the context's render commands.
+		RenderCommandList* recording_list = (RenderCommandList::GetRecordingInterface() ? context->render_commands.get() : nullptr);
+		RenderInterface* render_interface = ::Rml::GetRenderInterface();
+
+		const TextureHandle render_target = layer.BeginUpdate(render_interface, region);
+		if (!render_target)
+			return false;
+
+		if (recording_list)
+			recording_list->PauseRecording();
+
+		render_interface->PushRenderTarget(render_target, region);
+
+		// The render target has its own state, submit our clip region and transform to it.
+		ElementUtilities::ApplyActiveClipRegion(context);
+		render_interface->SetTransform(nullptr);
+
+		meta->background_border.Render(this);
+		meta->decoration.RenderDecorators();
+		OnRender();
+
+		for (Element* element : stacking_context)
+			element->Render();
+
+		render_interface->PopRenderTarget();
+
+		if (recording_list)
+			recording_list->ResumeRecording();
+
+		layer.EndUpdate();
+
+		// The render state submitted by our stacking context no longer applies after popping the render target, restore our own.
+		if (clip.Valid())
+			context->SetActiveClipRegion(clip.Position(), clip.Size());
+		else
+			context->SetActiveClipRegion(Vector2i(-1, -1), Vector2i(-1, -1));
+		ElementUtilities::ApplyActiveClipRegion(context);
+		ElementUtilities::ApplyTransform(*this);
+	}
+
+	layer.Render();
+
+	return true;
+}
+
+void Element::DirtyLayer()
+{
+	if (ElementLayer::GetNumLayers() == 0)
+		return;
+
+	for (Element* element = this; element; element = element->parent)
+	{
+		if (element->meta->layer)
+		{
+			element->meta->layer->DirtyLayer();
+			element->render_region_dirty = true;
+		}
+	}
+}
+
 void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 {
 	switch (dirty_nodes)
 	{
-	case DirtyNodes::Self: dirty_definition = true; break;
+	// Anything that can change the definition of this element can also change the definition of any descendants due to the presence of RCSS
+	// descendant or child combinators. Similarly, siblings may be affected due to sibling combinators.
+	case DirtyNodes::Self:
+		dirty_definition = true;
+		dirty_child_definitions = true;
+		break;
 	case DirtyNodes::SelfAndSiblings:
 		dirty_definition = true;
+		dirty_child_definitions = true;
 		if (parent)
 			parent->dirty_child_definitions = true;
 		break;
 	}
 }
 
-void Element::UpdateDefinition()
+void Element::DirtyDefinitionOnToggle(Atom name, bool is_pseudo_class)
 {
-	if (dirty_definition)
+	const StyleSheet* style_sheet = GetStyleSheet();
+	if (!style_sheet)
 	{
-		dirty_definition = false;
+		// Without a style sheet we can't tell which elements are affected, dirty all of them to be safe.
+		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		return;
+	}
+
+	// Use the style sheet's invalidation sets to only dirty the elements that can actually be affected by a rule using the given name.
+	const StyleInvalidation invalidation =
+		(is_pseudo_class ? style_sheet->GetPseudoClassInvalidation(name) : style_sheet->GetClassInvalidation(name));
 
-		// Dirty definition implies all our descendent elements. Anything that can change the definition of this element can also change the
-		// definition of any descendants due to the presence of RCSS descendant or child combinators. In principle this also applies to sibling
-		// combinators, but those are handled during the DirtyDefinition call.
+	if ((invalidation & StyleInvalidation::Self) != StyleInvalidation::None)
+		dirty_definition = true;
+	if ((invalidation & StyleInvalidation::Descendants) != StyleInvalidation::None)
 		dirty_child_definitions = true;
+	if ((invalidation & StyleInvalidation::Siblings) != StyleInvalidation::None && parent)
+		parent->dirty_child_definitions = true;
+}
 
+void Element::UpdateDefinition()
+{
+	if (dirty_definition)
+	{
+		dirty_definition = false;
 		GetStyle()->UpdateDefinition();
 	}
 
@@ -2344,7 +2871,10 @@ void Element::UpdateDefinition()
 	{
 		dirty_child_definitions = false;
 		for (const ElementPtr& child : children)
+		{
 			child->dirty_definition = true;
+			child->dirty_child_definitions = true;
+		}
 	}
 }
 
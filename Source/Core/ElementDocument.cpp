@@ -43,6 +43,7 @@
 #include "Template.h"
 #include "TemplateCache.h"
 #include "XMLParseTools.h"
+#include <algorithm>
 #include <limits.h>
 
 namespace Rml {
@@ -518,6 +519,48 @@ void ElementDocument::UpdateLayout()
 {
 	// Note: Carefully consider when to call this function for performance reasons.
 	// Ideally, only called once per update loop.
+	if (!layout_dirty && !dirty_layout_boundaries.empty())
+	{
+		RMLUI_ZoneScopedN("LayoutBoundaries");
+
+		// Move the list out first, formatting may dirty new boundaries which we ignore here just like in the whole document case below.
+		const Vector<ObserverPtr<Element>> boundaries = std::move(dirty_layout_boundaries);
+		dirty_layout_boundaries.clear();
+
+		bool format_document = false;
+
+		auto IsDirtyBoundary = [&boundaries](const Element* element) {
+			return std::any_of(boundaries.begin(), boundaries.end(), [element](const ObserverPtr<Element>& other) { return other.get() == element; });
+		};
+
+		for (const ObserverPtr<Element>& boundary_ptr : boundaries)
+		{
+			Element* boundary = boundary_ptr.get();
+
+			// Boundaries that have since been removed from this document no longer need any layout.
+			if (!boundary || boundary->GetOwnerDocument() != this)
+				continue;
+
+			// Skip boundaries inside other dirty boundaries, they will be formatted along with their ancestor.
+			bool ancestor_is_dirty = false;
+			for (Element* ancestor = boundary->GetParentNode(); ancestor && ancestor != this; ancestor = ancestor->GetParentNode())
+				ancestor_is_dirty |= IsDirtyBoundary(ancestor);
+			if (ancestor_is_dirty)
+				continue;
+
+			// If the boundary can no longer be formatted in isolation, fall back to formatting the whole document.
+			if (!LayoutEngine::FormatLayoutBoundary(boundary))
+			{
+				format_document = true;
+				break;
+			}
+		}
+
+		// As below, ignore layout dirtied during formatting.
+		layout_dirty = format_document;
+		dirty_layout_boundaries.clear();
+	}
+
 	if (layout_dirty)
 	{
 		RMLUI_ZoneScoped;
@@ -532,6 +575,7 @@ void ElementDocument::UpdateLayout()
 		// Ignore dirtied layout during document formatting. Layouting must not require re-iteration.
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
+		dirty_layout_boundaries.clear();
 	}
 }
 
@@ -591,6 +635,17 @@ bool ElementDocument::IsLayoutDirty()
 	return layout_dirty;
 }
 
+void ElementDocument::DirtyLayoutBoundary(Element* layout_boundary)
+{
+	RMLUI_ASSERT(layout_boundary && layout_boundary->GetOwnerDocument() == this);
+
+	const auto it = std::find_if(dirty_layout_boundaries.begin(), dirty_layout_boundaries.end(),
+		[layout_boundary](const ObserverPtr<Element>& boundary) { return boundary.get() == layout_boundary; });
+
+	if (it == dirty_layout_boundaries.end())
+		dirty_layout_boundaries.push_back(layout_boundary->GetObserverPtr());
+}
+
 void ElementDocument::DirtyVwAndVhProperties()
 {
 	GetStyle()->DirtyPropertiesWithUnitsRecursive(Unit::VW | Unit::VH);
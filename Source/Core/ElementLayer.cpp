@@ -0,0 +1,111 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementLayer.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "RenderCommandList.h"
+#include <algorithm>
+
+namespace Rml {
+
+static Vector<ElementLayer*> layers;
+
+ElementLayer::ElementLayer()
+{
+	layers.push_back(this);
+}
+
+ElementLayer::~ElementLayer()
+{
+	Release();
+	layers.erase(std::find(layers.begin(), layers.end(), this));
+}
+
+bool ElementLayer::IsDirty(Rectanglei new_region) const
+{
+	return dirty || !render_target || !(region == new_region);
+}
+
+TextureHandle ElementLayer::BeginUpdate(RenderInterface* render_interface, Rectanglei new_region)
+{
+	// The render target is only recreated when the size of the region changes, otherwise its contents are simply replaced.
+	if (render_target && render_target_dimensions != new_region.Size())
+		Release();
+
+	if (!render_target)
+	{
+		render_target = render_interface->CreateRenderTarget(new_region.Size());
+		render_target_dimensions = new_region.Size();
+	}
+
+	if (render_target)
+	{
+		region = new_region;
+		GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(region.Position()), Vector2f(region.Size()), Colourb(255), Vector2f(0, 0),
+			Vector2f(1, 1));
+	}
+
+	return render_target;
+}
+
+void ElementLayer::EndUpdate()
+{
+	dirty = false;
+}
+
+void ElementLayer::Render()
+{
+	RenderInterface* render_interface = RenderCommandList::GetActiveRenderInterface();
+	if (render_target && render_interface)
+		render_interface->RenderGeometry(vertices, 4, indices, 6, render_target, Vector2f(0, 0));
+}
+
+void ElementLayer::Release()
+{
+	if (render_target)
+	{
+		RenderCommandList::ReleaseTexture(render_target);
+		render_target = 0;
+	}
+	dirty = true;
+}
+
+int ElementLayer::GetNumLayers()
+{
+	return (int)layers.size();
+}
+
+void ElementLayer::ReleaseAll()
+{
+	for (ElementLayer* layer : layers)
+		layer->Release();
+}
+
+} // namespace Rml
@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ELEMENTLAYER_H
+#define RMLUI_CORE_ELEMENTLAYER_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+
+class RenderInterface;
+
+/**
+    Caches the rendered output of an element with 'layer: cached' in a render target.
+
+    The element and its stacking context are rendered into the render target whenever the layer is dirtied, or the region it
+    covers changes. Otherwise, the render target is composited as a single quad.
+ */
+
+class ElementLayer : NonCopyMoveable {
+public:
+	ElementLayer();
+	~ElementLayer();
+
+	/// Marks the contents of the layer as changed, they are rendered again when the layer is next rendered.
+	void DirtyLayer() { dirty = true; }
+
+	/// Returns true if the contents of the layer need to be rendered again to cover the given region.
+	bool IsDirty(Rectanglei region) const;
+
+	/// Prepares a render target for rendering the contents of the layer into, reusing the previous one if possible.
+	/// @param[in] render_interface The render interface to create the render target with.
+	/// @param[in] region The region of the context covered by the layer.
+	/// @return The render target, or zero if render targets are not supported by the render interface.
+	TextureHandle BeginUpdate(RenderInterface* render_interface, Rectanglei region);
+	/// Called after the contents of the layer have been rendered into the render target.
+	void EndUpdate();
+
+	/// Composites the render target of the layer.
+	void Render();
+
+	/// Releases the render target of the layer.
+	void Release();
+
+	/// Returns the number of layers in existence.
+	static int GetNumLayers();
+	/// Releases the render targets of all layers, they are recreated when next rendered.
+	static void ReleaseAll();
+
+private:
+	TextureHandle render_target = 0;
+	Vector2i render_target_dimensions;
+
+	Rectanglei region = Rectanglei::MakeInvalid();
+	bool dirty = true;
+
+	Vertex vertices[4];
+	int indices[6];
+};
+
+} // namespace Rml
+#endif
@@ -47,6 +47,7 @@
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
 #include "PropertiesIterator.h"
+#include "StyleSharingCache.h"
 #include <algorithm>
 
 namespace Rml {
@@ -63,6 +64,7 @@ inline PseudoClassState operator&(PseudoClassState lhs, PseudoClassState rhs)
 ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
+	tag = AtomTable::GetOrCreate(element->GetTagName());
 }
 
 const Property* ElementStyle::GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition)
@@ -214,6 +216,11 @@ void ElementStyle::UpdateDefinition()
 }
 
 bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
+{
+	return SetPseudoClass(activate ? AtomTable::GetOrCreate(pseudo_class) : AtomTable::Find(pseudo_class), activate, override_class);
+}
+
+bool ElementStyle::SetPseudoClass(Atom pseudo_class, bool activate, bool override_class)
 {
 	bool changed = false;
 
@@ -222,6 +229,7 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 		PseudoClassState& state = pseudo_classes[pseudo_class];
 		changed = (state == PseudoClassState::Clear);
 		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
+		pseudo_class_mask |= GetAtomMaskBit(pseudo_class);
 	}
 	else
 	{
@@ -234,6 +242,10 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 			{
 				pseudo_classes.erase(it);
 				changed = true;
+
+				pseudo_class_mask = 0;
+				for (const auto& pair : pseudo_classes)
+					pseudo_class_mask |= GetAtomMaskBit(pair.first);
 			}
 		}
 	}
@@ -243,6 +255,13 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 
 bool ElementStyle::IsPseudoClassSet(const String& pseudo_class) const
 {
+	return IsPseudoClassSet(AtomTable::Find(pseudo_class));
+}
+
+bool ElementStyle::IsPseudoClassSet(Atom pseudo_class) const
+{
+	if (!(pseudo_class_mask & GetAtomMaskBit(pseudo_class)))
+		return false;
 	return (pseudo_classes.count(pseudo_class) == 1);
 }
 
@@ -251,62 +270,116 @@ const PseudoClassMap& ElementStyle::GetActivePseudoClasses() const
 	return pseudo_classes;
 }
 
+uint64_t ElementStyle::GetPseudoClassMask() const
+{
+	return pseudo_class_mask;
+}
+
 bool ElementStyle::SetClass(const String& class_name, bool activate)
 {
-	const auto class_location = std::find(classes.begin(), classes.end(), class_name);
+	if (class_name.empty())
+		return false;
+
+	const auto class_location = std::find(class_names.begin(), class_names.end(), class_name);
 
 	bool changed = false;
 	if (activate)
 	{
-		if (class_location == classes.end())
+		if (class_location == class_names.end())
 		{
-			classes.push_back(class_name);
+			class_names.push_back(class_name);
 			changed = true;
 		}
 	}
 	else
 	{
-		if (class_location != classes.end())
+		if (class_location != class_names.end())
 		{
-			classes.erase(class_location);
+			class_names.erase(class_location);
 			changed = true;
 		}
 	}
 
+	if (changed)
+		atoms_generation = 0;
+
 	return changed;
 }
 
 bool ElementStyle::IsClassSet(const String& class_name) const
 {
+	return std::find(class_names.begin(), class_names.end(), class_name) != class_names.end();
+}
+
+bool ElementStyle::IsClassSet(Atom class_name) const
+{
+	UpdateAtoms();
+	if (!(class_mask & GetAtomMaskBit(class_name)))
+		return false;
 	return std::find(classes.begin(), classes.end(), class_name) != classes.end();
 }
 
-void ElementStyle::SetClassNames(const String& class_names)
+void ElementStyle::SetClassNames(const String& new_class_names)
 {
-	classes.clear();
-	StringUtilities::ExpandString(classes, class_names, ' ');
+	class_names.clear();
+	StringUtilities::ExpandString(class_names, new_class_names, ' ');
+	atoms_generation = 0;
 }
 
 String ElementStyle::GetClassNames() const
 {
-	String class_names;
-	for (size_t i = 0; i < classes.size(); i++)
-	{
-		if (i != 0)
-		{
-			class_names += " ";
-		}
-		class_names += classes[i];
-	}
-
-	return class_names;
+	String result;
+	StringUtilities::JoinString(result, class_names, ' ');
+	return result;
 }
 
-const StringList& ElementStyle::GetClassNameList() const
+const AtomList& ElementStyle::GetClassList() const
 {
+	UpdateAtoms();
 	return classes;
 }
 
+uint64_t ElementStyle::GetClassMask() const
+{
+	UpdateAtoms();
+	return class_mask;
+}
+
+Atom ElementStyle::GetTag() const
+{
+	return tag;
+}
+
+void ElementStyle::SetId(const String& new_id)
+{
+	id_name = new_id;
+	atoms_generation = 0;
+}
+
+Atom ElementStyle::GetId() const
+{
+	UpdateAtoms();
+	return id;
+}
+
+void ElementStyle::LookupAtoms() const
+{
+	atoms_generation = AtomTable::GetGeneration();
+	id = AtomTable::Find(id_name);
+
+	classes.clear();
+	class_mask = 0;
+	for (const String& class_name : class_names)
+	{
+		const Atom class_atom = AtomTable::Find(class_name);
+		if (class_atom != Atom::None)
+		{
+			classes.push_back(class_atom);
+			class_mask |= GetAtomMaskBit(class_atom);
+		}
+	}
+}
+
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
 	Property new_property = property;
@@ -515,6 +588,18 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	// Freshly created elements without any inline properties can copy the values computed for a sibling with the same definition.
+	const bool style_sharing_candidate = (values_are_default_initialized && inline_properties.GetNumProperties() == 0);
+	if (style_sharing_candidate)
+	{
+		if (const Style::ComputedValues* shared_values = StyleSharingCache::FindComputedValues(element, definition.get()))
+		{
+			values.CopyNonInherited(*shared_values);
+			values.CopyInherited(*shared_values);
+			return PassDirtyPropertiesToChildren();
+		}
+	}
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -818,6 +903,9 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		case PropertyId::OverscrollBehavior:
 			values.overscroll_behavior((OverscrollBehavior)p->Get<int>());
 			break;
+		case PropertyId::Layer:
+			values.layer((Layer)p->Get<int>());
+			break;
 		case PropertyId::PointerEvents:
 			values.pointer_events((PointerEvents)p->Get<int>());
 			break;
@@ -896,7 +984,15 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
 	}
 
-	// Next, pass inheritable dirty properties onto our children
+	if (style_sharing_candidate)
+		StyleSharingCache::StoreComputedValues(element, definition, values);
+
+	return PassDirtyPropertiesToChildren();
+}
+
+PropertyIdSet ElementStyle::PassDirtyPropertiesToChildren()
+{
+	// Pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
 	if (!dirty_inherited_properties.Empty())
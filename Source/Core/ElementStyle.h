@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
 
 namespace Rml {
 
@@ -41,7 +42,7 @@ class PropertiesIterator;
 enum class RelativeTarget;
 
 enum class PseudoClassState : uint8_t { Clear = 0, Set = 1, Override = 2 };
-using PseudoClassMap = SmallUnorderedMap<String, PseudoClassState>;
+using PseudoClassMap = SmallUnorderedMap<Atom, PseudoClassState>;
 
 /**
     Manages an element's style and property information.
@@ -64,12 +65,18 @@ public:
 	/// @note An overriden pseudo class means that it will act as if activated even when it has been cleared the normal way.
 	/// @return True if the pseudo class was changed.
 	bool SetPseudoClass(const String& pseudo_class, bool activate, bool override_class = false);
+	/// Sets or removes an interned pseudo-class on the element.
+	bool SetPseudoClass(Atom pseudo_class, bool activate, bool override_class = false);
 	/// Checks if a specific pseudo-class has been set on the element.
 	/// @param[in] pseudo_class The name of the pseudo-class to check for.
 	/// @return True if the pseudo-class is set on the element, false if not.
 	bool IsPseudoClassSet(const String& pseudo_class) const;
+	/// Checks if a specific pseudo-class has been set on the element.
+	bool IsPseudoClassSet(Atom pseudo_class) const;
 	/// Gets a list of the current active pseudo classes
 	const PseudoClassMap& GetActivePseudoClasses() const;
+	/// Returns the mask of all active pseudo classes, see GetAtomMaskBit().
+	uint64_t GetPseudoClassMask() const;
 
 	/// Sets or removes a class on the element.
 	/// @param[in] class_name The name of the class to add or remove from the class list.
@@ -80,14 +87,25 @@ public:
 	/// @param[in] class_name The name of the class to check for.
 	/// @return True if the class is set on the element, false otherwise.
 	bool IsClassSet(const String& class_name) const;
+	/// Checks if a class is set on the element.
+	bool IsClassSet(Atom class_name) const;
 	/// Specifies the entire list of classes for this element. This will replace any others specified.
 	/// @param[in] class_names The list of class names to set on the style, separated by spaces.
 	void SetClassNames(const String& class_names);
 	/// Return the active class list.
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
-	/// Return the active class list.
-	const StringList& GetClassNameList() const;
+	/// Returns the atoms of the active classes used by any style sheet, classes never interned in the atom table are left out.
+	const AtomList& GetClassList() const;
+	/// Returns the mask of all active classes, see GetAtomMaskBit().
+	uint64_t GetClassMask() const;
+
+	/// Returns the tag name of the element.
+	Atom GetTag() const;
+	/// Sets the id of the element used for selector matching.
+	void SetId(const String& id);
+	/// Returns the atom of the element's id, or 'None' if the id is not used by any style sheet.
+	Atom GetId() const;
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
@@ -146,6 +164,8 @@ public:
 private:
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
+	// Dirties the inherited properties among our dirty properties on all children, then clears and returns our dirty properties.
+	PropertyIdSet PassDirtyPropertiesToChildren();
 
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition);
 	static const Property* GetProperty(PropertyId id, const Element* element, const PropertyDictionary& inline_properties,
@@ -156,11 +176,33 @@ private:
 	// Element these properties belong to
 	Element* element;
 
-	// The list of classes applicable to this object.
-	StringList classes;
+	// Looks up the atoms of the id and classes again if they are out of date with the atom table.
+	void UpdateAtoms() const
+	{
+		if (atoms_generation != AtomTable::GetGeneration())
+			LookupAtoms();
+	}
+	void LookupAtoms() const;
+
+	// The element's tag, interned for fast selector matching.
+	Atom tag = Atom::None;
+
+	// The element's id and the list of classes applicable to this object.
+	String id_name;
+	StringList class_names;
+	// Atoms of the id and classes, only looked up so that names generated at runtime are not interned. They are looked up again when the atom
+	// table changes, since names may have been interned by a new style sheet.
+	mutable Atom id = Atom::None;
+	mutable AtomList classes;
+	mutable uint32_t atoms_generation = 0;
+
 	// This element's current pseudo-classes.
 	PseudoClassMap pseudo_classes;
 
+	// Masks of the above classes and pseudo-classes, for quickly ruling out selectors with classes not set on the element.
+	mutable uint64_t class_mask = 0;
+	uint64_t pseudo_class_mask = 0;
+
 	// Any properties that have been overridden in this element.
 	PropertyDictionary inline_properties;
 	// The definition of this element, provides applicable properties from the stylesheet.
@@ -97,6 +97,40 @@ void ElementText::OnRender()
 	if (font_face_handle == 0)
 		return;
 
+	const Vector2f translation = GetAbsoluteOffset();
+
+	// Skip the text if all of its lines are outside the clipping region, before regenerating any geometry.
+	bool render = true;
+	Vector2i clip_origin;
+	Vector2i clip_dimensions;
+	if (GetContext()->GetActiveClipRegion(clip_origin, clip_dimensions))
+	{
+		const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(GetFontFaceHandle());
+		float clip_top = (float)clip_origin.y;
+		float clip_left = (float)clip_origin.x;
+		float clip_right = (float)(clip_origin.x + clip_dimensions.x);
+		float clip_bottom = (float)(clip_origin.y + clip_dimensions.y);
+		float ascent = font_metrics.ascent;
+		float descent = font_metrics.descent;
+
+		render = false;
+		for (const Line& line : lines)
+		{
+			float x_left = translation.x + line.position.x;
+			float x_right = x_left + line.width;
+			float y = translation.y + line.position.y;
+			float y_top = y - ascent;
+			float y_bottom = y + descent;
+
+			render = !(x_left > clip_right || x_right < clip_left || y_top > clip_bottom || y_bottom < clip_top);
+			if (render)
+				break;
+		}
+	}
+
+	if (!render)
+		return;
+
 	// If our font effects have potentially changed, update it and force a geometry generation if necessary.
 	if (font_effects_dirty && UpdateFontEffects())
 		geometry_dirty = true;
@@ -133,41 +167,8 @@ void ElementText::OnRender()
 		generated_decoration = decoration_property;
 	}
 
-	const Vector2f translation = GetAbsoluteOffset();
-
-	bool render = true;
-	Vector2i clip_origin;
-	Vector2i clip_dimensions;
-	if (GetContext()->GetActiveClipRegion(clip_origin, clip_dimensions))
-	{
-		const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(GetFontFaceHandle());
-		float clip_top = (float)clip_origin.y;
-		float clip_left = (float)clip_origin.x;
-		float clip_right = (float)(clip_origin.x + clip_dimensions.x);
-		float clip_bottom = (float)(clip_origin.y + clip_dimensions.y);
-		float ascent = font_metrics.ascent;
-		float descent = font_metrics.descent;
-
-		render = false;
-		for (const Line& line : lines)
-		{
-			float x_left = translation.x + line.position.x;
-			float x_right = x_left + line.width;
-			float y = translation.y + line.position.y;
-			float y_top = y - ascent;
-			float y_bottom = y + descent;
-
-			render = !(x_left > clip_right || x_right < clip_left || y_top > clip_bottom || y_bottom < clip_top);
-			if (render)
-				break;
-		}
-	}
-
-	if (render)
-	{
-		for (size_t i = 0; i < geometry.size(); ++i)
-			geometry[i].Render(translation);
-	}
+	for (size_t i = 0; i < geometry.size(); ++i)
+		geometry[i].Render(translation);
 
 	if (decoration)
 		decoration->Render(translation);
@@ -299,6 +300,8 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 
 void ElementText::ClearLines()
 {
+	DirtyRender();
+
 	// Clear the rendering information.
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].Release(true);
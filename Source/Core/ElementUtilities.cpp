@@ -40,6 +40,7 @@
 #include "ElementStyle.h"
 #include "Layout/LayoutDetails.h"
 #include "Layout/LayoutEngine.h"
+#include "RenderCommandList.h"
 #include "TransformState.h"
 #include <limits>
 
@@ -264,7 +265,7 @@ bool ElementUtilities::SetClippingRegion(Element* element, Context* context)
 
 void ElementUtilities::ApplyActiveClipRegion(Context* context)
 {
-	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	RenderInterface* render_interface = RenderCommandList::GetActiveRenderInterface();
 	if (!render_interface)
 		return;
 
@@ -315,7 +316,7 @@ bool ElementUtilities::PositionElement(Element* element, Vector2f offset, Positi
 
 bool ElementUtilities::ApplyTransform(Element& element)
 {
-	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	RenderInterface* render_interface = RenderCommandList::GetActiveRenderInterface();
 	if (!render_interface)
 		return false;
 
@@ -383,9 +384,13 @@ static bool ApplyDataViewsControllersInternal(Element* element, const bool const
 
 				ViewControllerInitializer initializer;
 
-				// Structural data views are applied in a separate step from the normal views and controllers.
+				// Structural data views are applied in a separate step from the normal views and controllers. They take no modifier,
+				// which leaves attributes such as 'data-for-key' to configure the view.
 				if (construct_structural_view)
 				{
+					if (type_end != String::npos)
+						continue;
+
 					if (DataViewPtr view = Factory::InstanceDataView(type_name, element, true))
 					{
 						initializer.modifier_or_inner_rml = structural_view_inner_rml;
@@ -191,12 +191,24 @@ void ElementImage::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
+	// Map the texture coordinates into the texture's region of its atlas page, if any.
+	const Rectanglef tex_coord_region = texture.GetTexCoordRegion();
+	for (Vector2f& texcoord : texcoords)
+		texcoord = tex_coord_region.TopLeft() + texcoord * tex_coord_region.Size();
+
 	const ComputedValues& computed = GetComputedValues();
 
 	float opacity = computed.opacity();
 	Colourb quad_colour = computed.image_color();
 	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
 
+	// Atlas pages have premultiplied alpha, so the colour must be premultiplied as well.
+	if (texture.IsInAtlas())
+	{
+		const float alpha = (float)quad_colour.alpha / 255.f;
+		quad_colour = Colourb((byte)(alpha * quad_colour.red), (byte)(alpha * quad_colour.green), (byte)(alpha * quad_colour.blue), quad_colour.alpha);
+	}
+
 	Vector2f quad_size = GetBox().GetSize(BoxArea::Content).Round();
 
 	GeometryUtilities::GenerateQuad(&vertices[0], &indices[0], Vector2f(0, 0), quad_size, quad_colour, texcoords[0], texcoords[1]);
@@ -260,6 +272,7 @@ bool ElementImage::LoadTexture()
 			source_url.SetURL(document->GetSourceURL());
 
 		texture.Set(source_name, source_url.GetPath());
+		texture.AllowAtlas();
 
 		dimensions_scale = dp_ratio;
 	}
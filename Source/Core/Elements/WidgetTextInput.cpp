@@ -326,6 +326,7 @@ void WidgetTextInput::OnUpdate()
 		cursor_timer -= float(current_time - last_update_time);
 		last_update_time = current_time;
 
+		const bool old_cursor_visible = cursor_visible;
 		while (cursor_timer <= 0)
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
@@ -335,7 +336,11 @@ void WidgetTextInput::OnUpdate()
 		if (parent->IsVisible(true))
 		{
 			if (Context* ctx = parent->GetContext())
+			{
 				ctx->RequestNextUpdate(cursor_timer);
+				if (cursor_visible != old_cursor_visible)
+					parent->DirtyRender();
+			}
 		}
 	}
 }
@@ -985,6 +990,8 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 
 void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 {
+	parent->DirtyRender();
+
 	if (show)
 	{
 		cursor_visible = true;
@@ -1078,6 +1085,8 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 	if (!font_handle)
 		return content_area;
 
+	parent->DirtyRender();
+
 	// Clear the old lines, and all the lines in the text elements.
 	lines.clear();
 	text_element->ClearLines();
@@ -1314,6 +1323,8 @@ void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
 
 	if (update_ideal_cursor_position)
 		ideal_cursor_position = cursor_position.x;
+
+	parent->DirtyRender();
 }
 
 bool WidgetTextInput::UpdateSelection(bool selecting)
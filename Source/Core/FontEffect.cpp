@@ -49,6 +49,11 @@ void FontEffect::GenerateGlyphTexture(byte* /*destination_data*/, Vector2i /*des
 	const FontGlyph& /*glyph*/) const
 {}
 
+bool FontEffect::GetDistanceFieldParameters(float& /*width*/, float& /*softness*/, Vector2i& /*offset*/) const
+{
+	return false;
+}
+
 void FontEffect::SetColour(const Colourb _colour)
 {
 	colour = _colour;
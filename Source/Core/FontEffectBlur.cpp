@@ -112,6 +112,14 @@ void FontEffectBlur::GenerateGlyphTexture(byte* destination_data, const Vector2i
 		ColorFormat::A8);
 }
 
+bool FontEffectBlur::GetDistanceFieldParameters(float& out_width, float& softness, Vector2i& /*offset*/) const
+{
+	// Fade over two standard deviations of the Gaussian on each side of the outline.
+	out_width = 0.f;
+	softness = .8f * float(width);
+	return true;
+}
+
 FontEffectBlurInstancer::FontEffectBlurInstancer() : id_width(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
 	id_width = RegisterProperty("width", "1px", true).AddParser("length").GetId();
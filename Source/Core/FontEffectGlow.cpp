@@ -142,6 +142,15 @@ void FontEffectGlow::GenerateGlyphTexture(byte* destination_data, const Vector2i
 		Vector2i(0), ColorFormat::A8);
 }
 
+bool FontEffectGlow::GetDistanceFieldParameters(float& width, float& softness, Vector2i& out_offset) const
+{
+	// Fade over two standard deviations of the Gaussian on each side of the outline.
+	width = float(width_outline);
+	softness = .8f * float(width_blur);
+	out_offset = offset;
+	return true;
+}
+
 FontEffectGlowInstancer::FontEffectGlowInstancer() :
 	id_width_outline(PropertyId::Invalid), id_width_blur(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
@@ -95,6 +95,13 @@ void FontEffectOutline::GenerateGlyphTexture(byte* destination_data, const Vecto
 		Vector2i(width), glyph.color_format);
 }
 
+bool FontEffectOutline::GetDistanceFieldParameters(float& out_width, float& softness, Vector2i& /*offset*/) const
+{
+	out_width = float(width);
+	softness = 0.f;
+	return true;
+}
+
 FontEffectOutlineInstancer::FontEffectOutlineInstancer() : id_width(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
 	id_width = RegisterProperty("width", "1px", true).AddParser("length").GetId();
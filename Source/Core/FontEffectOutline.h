@@ -54,6 +54,8 @@ public:
 
 	void GenerateGlyphTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride, const FontGlyph& glyph) const override;
 
+	bool GetDistanceFieldParameters(float& width, float& softness, Vector2i& offset) const override;
+
 private:
 	int width;
 	ConvolutionFilter filter;
@@ -58,6 +58,14 @@ bool FontEffectShadow::GetGlyphMetrics(Vector2i& origin, Vector2i& /*dimensions*
 	return true;
 }
 
+bool FontEffectShadow::GetDistanceFieldParameters(float& width, float& softness, Vector2i& out_offset) const
+{
+	width = 0.f;
+	softness = 0.f;
+	out_offset = offset;
+	return true;
+}
+
 FontEffectShadowInstancer::FontEffectShadowInstancer() :
 	id_offset_x(PropertyId::Invalid), id_offset_y(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
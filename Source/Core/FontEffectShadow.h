@@ -51,6 +51,8 @@ public:
 
 	bool GetGlyphMetrics(Vector2i& origin, Vector2i& dimensions, const FontGlyph& glyph) const override;
 
+	bool GetDistanceFieldParameters(float& width, float& softness, Vector2i& offset) const override;
+
 private:
 	Vector2i offset;
 };
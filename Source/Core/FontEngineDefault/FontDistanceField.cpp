@@ -0,0 +1,205 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontDistanceField.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+
+namespace Rml {
+
+static constexpr float infinity = 1e20f;
+
+// Computes the one-dimensional squared distance transform of the sampled function 'f' of length 'n', along with the index of the nearest sample,
+// using the lower envelope of parabolas by Felzenszwalb and Huttenlocher. The 'parabolas' and 'boundaries' arrays are scratch space of length
+// 'n' and 'n + 1'.
+static void DistanceTransform(const float* f, int n, float* distances, int* nearest, int* parabolas, float* boundaries)
+{
+	int k = 0;
+	parabolas[0] = 0;
+	boundaries[0] = -infinity;
+	boundaries[1] = infinity;
+
+	for (int q = 1; q < n; q++)
+	{
+		float s = 0.f;
+		while (true)
+		{
+			const int p = parabolas[k];
+			s = ((f[q] + float(q * q)) - (f[p] + float(p * p))) / float(2 * q - 2 * p);
+			if (s > boundaries[k] || k == 0)
+				break;
+			k--;
+		}
+
+		k++;
+		parabolas[k] = q;
+		boundaries[k] = s;
+		boundaries[k + 1] = infinity;
+	}
+
+	k = 0;
+	for (int q = 0; q < n; q++)
+	{
+		while (boundaries[k + 1] < float(q))
+			k++;
+
+		const int p = parabolas[k];
+		distances[q] = float((q - p) * (q - p)) + f[p];
+		nearest[q] = p;
+	}
+}
+
+// Finds the nearest seed of each pixel, as an index into the image. Returns false if there are no seeds.
+static bool NearestSeedTransform(const Vector<bool>& seeds, Vector2i dimensions, Vector<int>& nearest_seeds)
+{
+	const int w = dimensions.x;
+	const int h = dimensions.y;
+	const int n = Math::Max(w, h);
+
+	Vector<float> f(n), distances(n), column_distances(w * h), boundaries(n + 1);
+	Vector<int> nearest(n), parabolas(n), column_nearest(w * h);
+
+	// Transform each column, remembering the nearest row of each pixel.
+	bool any_seeds = false;
+	for (int x = 0; x < w; x++)
+	{
+		for (int y = 0; y < h; y++)
+		{
+			f[y] = (seeds[y * w + x] ? 0.f : infinity);
+			any_seeds |= seeds[y * w + x];
+		}
+
+		DistanceTransform(f.data(), h, distances.data(), nearest.data(), parabolas.data(), boundaries.data());
+
+		for (int y = 0; y < h; y++)
+		{
+			column_distances[y * w + x] = distances[y];
+			column_nearest[y * w + x] = nearest[y];
+		}
+	}
+
+	if (!any_seeds)
+		return false;
+
+	// Then transform each row of the column distances, the nearest seed is in the nearest column at its nearest row.
+	for (int y = 0; y < h; y++)
+	{
+		DistanceTransform(&column_distances[y * w], w, distances.data(), nearest.data(), parabolas.data(), boundaries.data());
+
+		for (int x = 0; x < w; x++)
+		{
+			const int seed_x = nearest[x];
+			const int seed_y = column_nearest[y * w + seed_x];
+			nearest_seeds[y * w + x] = seed_y * w + seed_x;
+		}
+	}
+
+	return true;
+}
+
+void FontDistanceField::ConvertGlyph(FontGlyph& glyph)
+{
+	if (!glyph.bitmap_data || glyph.bitmap_dimensions.x <= 0 || glyph.bitmap_dimensions.y <= 0)
+		return;
+
+	const Vector2i source_dimensions = glyph.bitmap_dimensions;
+	const Vector2i dimensions = source_dimensions + Vector2i(2 * spread);
+	const int num_pixels = dimensions.x * dimensions.y;
+	const int bytes_per_pixel = (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int alpha_offset = bytes_per_pixel - 1;
+
+	// Read the coverage of each pixel, including the padding around the glyph.
+	Vector<byte> coverage(num_pixels, 0);
+	for (int y = 0; y < source_dimensions.y; y++)
+	{
+		const byte* source_row = glyph.bitmap_data + y * source_dimensions.x * bytes_per_pixel;
+		byte* destination_row = &coverage[(y + spread) * dimensions.x + spread];
+		for (int x = 0; x < source_dimensions.x; x++)
+			destination_row[x] = source_row[x * bytes_per_pixel + alpha_offset];
+	}
+
+	// Pixels inside the glyph find their nearest pixel which is not fully covered, and pixels outside the glyph their nearest pixel which is at
+	// least partially covered. The outline is then placed within that pixel by its coverage, assuming a straight edge.
+	Vector<bool> inside_seeds(num_pixels), outside_seeds(num_pixels);
+	for (int i = 0; i < num_pixels; i++)
+	{
+		inside_seeds[i] = (coverage[i] < 255);
+		outside_seeds[i] = (coverage[i] > 0);
+	}
+
+	Vector<int> nearest_inside(num_pixels), nearest_outside(num_pixels);
+	const bool has_inside = NearestSeedTransform(inside_seeds, dimensions, nearest_inside);
+	const bool has_outside = NearestSeedTransform(outside_seeds, dimensions, nearest_outside);
+
+	UniquePtr<byte[]> data(new byte[num_pixels]);
+
+	for (int y = 0; y < dimensions.y; y++)
+	{
+		for (int x = 0; x < dimensions.x; x++)
+		{
+			const int i = y * dimensions.x + x;
+			const byte pixel_coverage = coverage[i];
+
+			float distance = 0.f;
+			if (pixel_coverage > 0 && pixel_coverage < 255)
+			{
+				distance = float(pixel_coverage) / 255.f - 0.5f;
+			}
+			else
+			{
+				const bool inside = (pixel_coverage == 255);
+				const bool has_seed = (inside ? has_inside : has_outside);
+				const int seed = (inside ? nearest_inside[i] : nearest_outside[i]);
+
+				float seed_distance = float(spread);
+				if (has_seed)
+				{
+					const Vector2f delta = Vector2f(float(seed % dimensions.x - x), float(seed / dimensions.x - y));
+					const float seed_offset = float(coverage[seed]) / 255.f - 0.5f;
+					seed_distance = delta.Magnitude() + (inside ? seed_offset : -seed_offset);
+				}
+
+				distance = (inside ? seed_distance : -seed_distance);
+			}
+
+			data[i] = byte(Math::Clamp(GetValue(distance) * 255.f + 0.5f, 0.f, 255.f));
+		}
+	}
+
+	glyph.bitmap_owned_data = std::move(data);
+	glyph.bitmap_data = glyph.bitmap_owned_data.get();
+	glyph.bitmap_dimensions = dimensions;
+	glyph.bearing += Vector2i(-spread, spread);
+	glyph.color_format = ColorFormat::A8;
+}
+
+float FontDistanceField::GetValue(float distance)
+{
+	return (128.f + distance * 127.f / float(spread)) / 255.f;
+}
+
+} // namespace Rml
@@ -0,0 +1,57 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTDISTANCEFIELD_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTDISTANCEFIELD_H
+
+#include "../../../Include/RmlUi/Core/FontGlyph.h"
+
+namespace Rml {
+
+/**
+    Conversion of glyph bitmaps into signed distance fields, which can be rendered at any size.
+ */
+
+namespace FontDistanceField {
+
+	// The font size, in pixels, at which glyphs are rendered into the distance field atlas of a font face.
+	static constexpr int reference_size = 48;
+	// The distance, in pixels at the reference size, covered by the distance field on each side of a glyph's outline.
+	static constexpr int spread = 12;
+
+	/// Replaces the glyph's bitmap by a signed distance field of its coverage, extending the bitmap by the spread on each side. The distance
+	/// field is stored in a single channel, thus color glyphs are converted using their alpha channel.
+	void ConvertGlyph(FontGlyph& glyph);
+
+	/// Returns the normalized value stored in the distance field at the given distance from a glyph's outline.
+	/// @param[in] distance The signed distance in pixels at the reference size, positive inside the glyph.
+	float GetValue(float distance);
+
+} // namespace FontDistanceField
+} // namespace Rml
+#endif
@@ -28,6 +28,7 @@
 
 #include "FontEngineInterfaceDefault.h"
 #include "FontFaceHandleDefault.h"
+#include "FontGlyphCache.h"
 #include "FontProvider.h"
 
 namespace Rml {
@@ -95,4 +96,24 @@ void FontEngineInterfaceDefault::ReleaseFontResources()
 	FontProvider::ReleaseFontResources();
 }
 
+void FontEngineInterfaceDefault::SetGlyphCacheBudget(size_t budget_bytes)
+{
+	FontGlyphCache::SetBudget(budget_bytes);
+}
+
+bool FontEngineInterfaceDefault::TrimGlyphCache()
+{
+	return FontGlyphCache::Trim();
+}
+
+FontGlyphCacheStatistics FontEngineInterfaceDefault::GetGlyphCacheStatistics()
+{
+	return FontGlyphCache::GetStatistics();
+}
+
+void FontEngineInterfaceDefault::SetDistanceFieldFonts(bool enable)
+{
+	FontProvider::SetDistanceFieldEnabled(enable);
+}
+
 } // namespace Rml
@@ -67,6 +67,16 @@ public:
 
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources() override;
+
+	/// Limits the size of all glyph textures, evicting the least recently used glyphs when over budget.
+	void SetGlyphCacheBudget(size_t budget_bytes) override;
+	/// Evicts the least recently used glyphs when over budget.
+	bool TrimGlyphCache() override;
+	/// Returns statistics of the glyphs of all font face handles.
+	FontGlyphCacheStatistics GetGlyphCacheStatistics() override;
+
+	/// Renders font face handles created from now on from distance field atlases shared by all sizes of a font face.
+	void SetDistanceFieldFonts(bool enable) override;
 };
 
 } // namespace Rml
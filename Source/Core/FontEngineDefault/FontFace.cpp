@@ -29,6 +29,7 @@
 #include "FontFace.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
 #include "FreeTypeInterface.h"
 
 namespace Rml {
@@ -69,9 +70,11 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 		return nullptr;
 	}
 
-	// Construct and initialise the new handle.
+	// Construct and initialise the new handle, rendering from the distance field atlas when enabled.
+	FontFaceHandleDefault* atlas = (FontProvider::IsDistanceFieldEnabled() ? GetDistanceFieldAtlas() : nullptr);
 	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+	const bool initialized = (atlas ? handle->InitializeDistanceField(face, size, atlas) : handle->Initialize(face, size, load_default_glyphs));
+	if (!initialized)
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -85,9 +88,22 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 	return result;
 }
 
+FontFaceHandleDefault* FontFace::GetDistanceFieldAtlas()
+{
+	if (!distance_field_atlas && face)
+	{
+		auto atlas = MakeUnique<FontFaceHandleDefault>();
+		if (atlas->InitializeDistanceFieldAtlas(face))
+			distance_field_atlas = std::move(atlas);
+	}
+
+	return distance_field_atlas.get();
+}
+
 void FontFace::ReleaseFontResources()
 {
 	HandleMap().swap(handles);
+	distance_field_atlas.reset();
 }
 
 } // namespace Rml
@@ -54,6 +54,10 @@ public:
 	/// @return The font handle.
 	FontFaceHandleDefault* GetHandle(int size, bool load_default_glyphs);
 
+	/// Returns the handle storing the glyphs of this face as distance fields, which are rendered at all sizes by distance field handles.
+	/// @return The atlas handle, or nullptr if it could not be created.
+	FontFaceHandleDefault* GetDistanceFieldAtlas();
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
 
@@ -61,6 +65,9 @@ private:
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
+	// Must outlive the sized handles, which may render from it.
+	UniquePtr<FontFaceHandleDefault> distance_field_atlas;
+
 	// Key is font size
 	using HandleMap = UnorderedMap<int, UniquePtr<FontFaceHandleDefault>>;
 	HandleMap handles;
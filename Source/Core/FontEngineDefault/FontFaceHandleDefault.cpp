@@ -27,10 +27,15 @@
  */
 
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../../Include/RmlUi/Core/TaskInterface.h"
 #include "../TextureLayout.h"
+#include "FontDistanceField.h"
 #include "FontFaceLayer.h"
+#include "FontGlyphCache.h"
 #include "FontProvider.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
@@ -45,10 +50,12 @@ FontFaceHandleDefault::FontFaceHandleDefault()
 	base_layer = nullptr;
 	metrics = {};
 	ft_face = 0;
+	FontGlyphCache::AddHandle(this);
 }
 
 FontFaceHandleDefault::~FontFaceHandleDefault()
 {
+	FontGlyphCache::RemoveHandle(this);
 	glyphs.clear();
 	layers.clear();
 }
@@ -62,6 +69,16 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
 		return false;
 
+	if (is_distance_field_atlas)
+	{
+		Vector<FontGlyph*> new_glyphs;
+		new_glyphs.reserve(glyphs.size());
+		for (auto& pair : glyphs)
+			new_glyphs.push_back(&pair.second);
+
+		GetTaskInterface()->ParallelFor((int)new_glyphs.size(), [&new_glyphs](int i) { FontDistanceField::ConvertGlyph(*new_glyphs[i]); });
+	}
+
 	has_kerning = FreeType::HasKerning(ft_face);
 	FillKerningPairCache();
 
@@ -72,6 +89,28 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	return true;
 }
 
+bool FontFaceHandleDefault::InitializeDistanceFieldAtlas(FontFaceHandleFreetype face)
+{
+	is_distance_field_atlas = true;
+	return Initialize(face, FontDistanceField::reference_size, true);
+}
+
+bool FontFaceHandleDefault::InitializeDistanceField(FontFaceHandleFreetype face, int font_size, FontFaceHandleDefault* atlas)
+{
+	RMLUI_ASSERT(atlas && atlas->is_distance_field_atlas);
+	distance_field_atlas = atlas;
+	distance_field_scale = float(font_size) / float(atlas->metrics.size);
+	distance_field_atlas_version = atlas->version;
+
+	if (!Initialize(face, font_size, false))
+		return false;
+
+	// Glyphs are scaled from the atlas as they are needed, instead of being rendered at our size.
+	glyphs.clear();
+
+	return true;
+}
+
 const FontMetrics& FontFaceHandleDefault::GetFontMetrics() const
 {
 	return metrics;
@@ -200,6 +239,17 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
 
+	// Append any new glyphs before generating geometry, so that the textures of each layer are known up front. Glyphs rendered from a distance
+	// field atlas are stored and tracked by the atlas.
+	FontFaceHandleDefault* glyph_owner = (distance_field_atlas ? distance_field_atlas : this);
+	const uint64_t tick = FontGlyphCache::NextTick();
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		Character character = *it_string;
+		if (GetOrAppendGlyph(character))
+			glyph_owner->glyph_last_used[character] = tick;
+	}
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
@@ -278,6 +328,26 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 
 bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
+	if (distance_field_atlas)
+	{
+		distance_field_atlas->UpdateLayersOnDirty();
+
+		if (distance_field_atlas_version == distance_field_atlas->version)
+		{
+			// Glyphs appended to the atlas may have added new textures to it.
+			for (auto& pair : layers)
+				pair.layer->AppendDistanceFieldTextures();
+			return false;
+		}
+
+		// Our version includes the version of the atlas, thus it has already changed.
+		distance_field_atlas_version = distance_field_atlas->version;
+		for (auto& pair : layers)
+			GenerateLayer(pair.layer.get());
+
+		return true;
+	}
+
 	bool result = false;
 
 	// If we are dirty, regenerate all the layers and increment the version
@@ -286,6 +356,9 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 		is_layers_dirty = false;
 		++version;
 
+		// All string geometry is now out of date, thus only glyphs used after this point are referred to by any geometry.
+		layers_regenerated_tick = FontGlyphCache::GetTick();
+
 		// Regenerate all the layers.
 		// Note: The layer regeneration needs to happen in the order in which the layers were created,
 		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
@@ -300,14 +373,89 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 	return result;
 }
 
+void FontFaceHandleDefault::AppendGlyphToLayers(Character character)
+{
+	if (is_layers_dirty)
+		return;
+
+	// Layers are appended to in the order they were created, so that cloned layers already contain the glyph.
+	for (auto& pair : layers)
+	{
+		bool clone_glyph_origins = true;
+		FontFaceLayer* clone = GetCloneLayer(pair.layer.get(), clone_glyph_origins);
+
+		if (!pair.layer->AppendGlyph(this, character, clone, clone_glyph_origins))
+		{
+			is_layers_dirty = true;
+			return;
+		}
+	}
+}
+
+void FontFaceHandleDefault::GetColdGlyphs(Vector<ColdGlyph>& cold_glyphs)
+{
+	// Our glyphs are stored by the atlas.
+	if (distance_field_atlas)
+		return;
+
+	int num_texture_layers = 0;
+	for (const auto& pair : layers)
+		num_texture_layers += (pair.layer->GetNumGeneratedTextures() > 0);
+
+	for (const auto& pair : glyphs)
+	{
+		const Character character = pair.first;
+		if (character == Character::Replacement || lent_glyphs.count(character))
+			continue;
+
+		auto it = glyph_last_used.find(character);
+		const uint64_t last_used = (it == glyph_last_used.end() ? 0 : it->second);
+		if (it != glyph_last_used.end() && last_used >= layers_regenerated_tick)
+			continue;
+
+		// Include the one-pixel gap around each glyph in the texture layout.
+		const Vector2i dimensions = pair.second.bitmap_dimensions;
+		const size_t texture_bytes = size_t(dimensions.x + 1) * size_t(dimensions.y + 1) * 4 * num_texture_layers;
+		cold_glyphs.push_back(ColdGlyph{last_used, this, character, texture_bytes});
+	}
+}
+
+void FontFaceHandleDefault::EvictGlyphs(const Vector<Character>& characters)
+{
+	for (Character character : characters)
+	{
+		glyphs.erase(character);
+		glyph_last_used.erase(character);
+	}
+
+	is_layers_dirty = true;
+	UpdateLayersOnDirty();
+}
+
+void FontFaceHandleDefault::AddGlyphCacheStatistics(FontGlyphCacheStatistics& statistics) const
+{
+	if (distance_field_atlas)
+		return;
+
+	statistics.num_glyphs += (int)glyphs.size();
+	for (const auto& pair : layers)
+	{
+		statistics.num_textures += pair.layer->GetNumGeneratedTextures();
+		statistics.texture_bytes += pair.layer->GetGeneratedTextureBytes();
+	}
+}
+
 int FontFaceHandleDefault::GetVersion() const
 {
-	return version;
+	// Geometry rendered from a distance field atlas must also be regenerated when the atlas regenerates its layers.
+	return version + (distance_field_atlas ? distance_field_atlas->version : 0);
 }
 
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
 	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
+	if (result && is_distance_field_atlas)
+		FontDistanceField::ConvertGlyph(glyphs[character]);
 	return result;
 }
 
@@ -367,6 +515,20 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 	if ((char32_t)character < (char32_t)' ')
 		return nullptr;
 
+	if (distance_field_atlas)
+	{
+		// Always look up the glyph in the atlas, since the atlas may have evicted it after we added it.
+		const FontGlyph* atlas_glyph = distance_field_atlas->GetOrAppendGlyph(character, look_in_fallback_fonts);
+		if (!atlas_glyph)
+			return nullptr;
+
+		auto it = glyphs.find(character);
+		if (it == glyphs.end())
+			it = glyphs.emplace(character, CreateDistanceFieldGlyph(*atlas_glyph)).first;
+
+		return &it->second;
+	}
+
 	auto it_glyph = glyphs.find(character);
 	if (it_glyph == glyphs.end())
 	{
@@ -381,25 +543,28 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				return nullptr;
 			}
 
-			is_layers_dirty = true;
+			AppendGlyphToLayers(character);
 		}
 		else if (look_in_fallback_fonts)
 		{
 			const int num_fallback_faces = FontProvider::CountFallbackFontFaces();
 			for (int i = 0; i < num_fallback_faces; i++)
 			{
-				FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
+				FontFaceHandleDefault* fallback_face =
+					(is_distance_field_atlas ? FontProvider::GetFallbackDistanceFieldAtlas(i) : FontProvider::GetFallbackFontFace(i, metrics.size));
 				if (!fallback_face || fallback_face == this)
 					continue;
 
 				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
 				if (glyph)
 				{
+					fallback_face->lent_glyphs.insert(character);
+
 					// Insert the new glyph into our own set of glyphs
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if (pair.second)
-						is_layers_dirty = true;
+						AppendGlyphToLayers(character);
 					break;
 				}
 			}
@@ -438,7 +603,8 @@ FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const Fon
 	auto& layer = layers.back().layer;
 
 	layer = MakeUnique<FontFaceLayer>(font_effect);
-	GenerateLayer(layer.get());
+	if (!GenerateLayer(layer.get()) && distance_field_atlas)
+		Log::Message(Log::LT_WARNING, "Font effect is not supported with distance field fonts, it will not be rendered.");
 
 	return layer.get();
 }
@@ -449,39 +615,63 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 	const FontEffect* font_effect = layer->GetFontEffect();
 	bool result = false;
 
-	if (!font_effect)
+	if (distance_field_atlas)
+	{
+		result = layer->GenerateDistanceField(distance_field_atlas->base_layer, distance_field_scale);
+	}
+	else if (!font_effect)
 	{
 		result = layer->Generate(this);
 	}
 	else
 	{
 		// Determine which, if any, layer the new layer should copy its geometry and textures from.
-		FontFaceLayer* clone = nullptr;
 		bool clone_glyph_origins = true;
-		String generation_key;
-		size_t fingerprint = font_effect->GetFingerprint();
-
-		if (!font_effect->HasUniqueTexture())
-		{
-			clone = base_layer;
-			clone_glyph_origins = false;
-		}
-		else
-		{
-			auto cache_iterator = layer_cache.find(fingerprint);
-			if (cache_iterator != layer_cache.end() && cache_iterator->second != layer)
-				clone = cache_iterator->second;
-		}
+		FontFaceLayer* clone = GetCloneLayer(layer, clone_glyph_origins);
 
 		// Create a new layer.
 		result = layer->Generate(this, clone, clone_glyph_origins);
 
 		// Cache the layer in the layer cache if it generated its own textures (ie, didn't clone).
 		if (!clone)
-			layer_cache[fingerprint] = layer;
+			layer_cache[font_effect->GetFingerprint()] = layer;
 	}
 
 	return result;
 }
 
+FontGlyph FontFaceHandleDefault::CreateDistanceFieldGlyph(const FontGlyph& atlas_glyph) const
+{
+	// Remove the spread which extends the bitmaps of the atlas glyphs.
+	Vector2f bearing = Vector2f(atlas_glyph.bearing);
+	if (atlas_glyph.bitmap_data && atlas_glyph.bitmap_dimensions.x > 0 && atlas_glyph.bitmap_dimensions.y > 0)
+		bearing += Vector2f(float(FontDistanceField::spread), -float(FontDistanceField::spread));
+
+	FontGlyph glyph;
+	glyph.dimensions = Vector2i((Vector2f(atlas_glyph.dimensions) * distance_field_scale).Round());
+	glyph.bearing = Vector2i((bearing * distance_field_scale).Round());
+	glyph.advance = int(float(atlas_glyph.advance) * distance_field_scale + 0.5f);
+	glyph.color_format = atlas_glyph.color_format;
+	return glyph;
+}
+
+FontFaceLayer* FontFaceHandleDefault::GetCloneLayer(FontFaceLayer* layer, bool& clone_glyph_origins)
+{
+	const FontEffect* font_effect = layer->GetFontEffect();
+	if (!font_effect)
+		return nullptr;
+
+	if (!font_effect->HasUniqueTexture())
+	{
+		clone_glyph_origins = false;
+		return base_layer;
+	}
+
+	auto cache_iterator = layer_cache.find(font_effect->GetFingerprint());
+	if (cache_iterator != layer_cache.end() && cache_iterator->second != layer)
+		return cache_iterator->second;
+
+	return nullptr;
+}
+
 } // namespace Rml
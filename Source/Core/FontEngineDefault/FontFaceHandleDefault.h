@@ -30,6 +30,7 @@
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEHANDLE_H
 
 #include "../../../Include/RmlUi/Core/FontEffect.h"
+#include "../../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/FontMetrics.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
@@ -51,6 +52,11 @@ public:
 	~FontFaceHandleDefault();
 
 	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	/// Initializes the handle to store its glyphs as signed distance fields in its base layer, for rendering them at any size through other
+	/// handles. The handle itself does not generate strings.
+	bool InitializeDistanceFieldAtlas(FontFaceHandleFreetype face);
+	/// Initializes the handle to render its glyphs by scaling the distance fields of the given atlas handle, which must outlive this handle.
+	bool InitializeDistanceField(FontFaceHandleFreetype face, int font_size, FontFaceHandleDefault* atlas);
 
 	const FontMetrics& GetFontMetrics() const;
 
@@ -87,7 +93,22 @@ public:
 	int GenerateString(GeometryList& geometry, const String& string, Vector2f position, Colourb colour, float opacity, float letter_spacing,
 		int layer_configuration = 0);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
+	struct ColdGlyph {
+		uint64_t last_used;
+		FontFaceHandleDefault* handle;
+		Character character;
+		// Estimated size of the glyph in the textures of all layers, in bytes.
+		size_t texture_bytes;
+	};
+	/// Adds the glyphs which have not been used since the layers were last regenerated, and which can be evicted, to the list of cold glyphs.
+	void GetColdGlyphs(Vector<ColdGlyph>& cold_glyphs);
+	/// Removes the given glyphs and regenerates all layers without them, thereby changing the version.
+	void EvictGlyphs(const Vector<Character>& characters);
+	/// Adds the number of glyphs, and the number and size of the layer textures, to the statistics.
+	void AddGlyphCacheStatistics(FontGlyphCacheStatistics& statistics) const;
+
+	/// Version is changed whenever the layers are regenerated, requiring regeneration of string geometry. New glyphs are normally added to
+	/// the layers without changing the version.
 	int GetVersion() const;
 
 private:
@@ -106,17 +127,33 @@ private:
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
+	// Regenerate layers if dirty, such as after failing to add new glyphs to them.
 	bool UpdateLayersOnDirty();
 
+	// Create the glyph of a handle rendered from a distance field atlas, by scaling the glyph of the atlas.
+	FontGlyph CreateDistanceFieldGlyph(const FontGlyph& atlas_glyph) const;
+
+	// Add a new glyph to all layers, or mark the layers as dirty if they need to be regenerated.
+	void AppendGlyphToLayers(Character character);
+
 	// Create a new layer from the given font effect if it does not already exist.
 	FontFaceLayer* GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect);
 
 	// (Re-)generate a layer in this font face handle.
 	bool GenerateLayer(FontFaceLayer* layer);
 
+	// Determine which, if any, layer the given layer should copy its geometry and textures from.
+	FontFaceLayer* GetCloneLayer(FontFaceLayer* layer, bool& clone_glyph_origins);
+
 	FontGlyphMap glyphs;
 
+	// The tick of the last string generated with each glyph.
+	UnorderedMap<Character, uint64_t> glyph_last_used;
+	// The tick at which the layers were last regenerated, glyphs not used since then are not part of any current string geometry.
+	uint64_t layers_regenerated_tick = 0;
+	// Glyphs used by other font face handles as a fallback, which refer to our bitmap data and must not be evicted.
+	UnorderedSet<Character> lent_glyphs;
+
 	struct EffectLayerPair {
 		const FontEffect* font_effect;
 		UniquePtr<FontFaceLayer> layer;
@@ -142,6 +179,14 @@ private:
 	bool is_layers_dirty = false;
 	int version = 0;
 
+	// True if our glyph bitmaps are signed distance fields, to be rendered by other handles.
+	bool is_distance_field_atlas = false;
+	// The handle which our glyphs are rendered from as distance fields, scaled from its size to our size, if any.
+	FontFaceHandleDefault* distance_field_atlas = nullptr;
+	float distance_field_scale = 1.f;
+	// The version of the atlas handle which our layers were last generated from.
+	int distance_field_atlas_version = 0;
+
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
 
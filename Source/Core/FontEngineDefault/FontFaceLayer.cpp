@@ -27,13 +27,20 @@
  */
 
 #include "FontFaceLayer.h"
+#include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/Math.h"
 #include "../../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../../Include/RmlUi/Core/TaskInterface.h"
+#include "../RenderCommandList.h"
+#include "FontDistanceField.h"
 #include "FontFaceHandleDefault.h"
 #include <string.h>
 
 namespace Rml {
 
+static constexpr int max_texture_dimensions = 1024;
+
 FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colour(255, 255, 255)
 {
 	effect = _effect;
@@ -47,8 +54,7 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 {
 	// Clear the old layout if it exists.
 	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
+		// New glyphs are usually added with AppendGlyph(), this is only reached when the layer needs to be generated from scratch.
 		texture_layout = TextureLayout{};
 		character_boxes.clear();
 		textures.clear();
@@ -64,7 +70,7 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 
 		// Copy the cloned layer's textures.
 		for (size_t i = 0; i < clone->textures.size(); ++i)
-			textures.push_back(clone->textures[i]);
+			textures.push_back(MakeUnique<Texture>(*clone->textures[i]));
 
 		// Request the effect (if we have one) and adjust the origins as appropriate.
 		if (effect && !clone_glyph_origins)
@@ -82,15 +88,7 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 					continue;
 				}
 
-				TextureBox& box = it->second;
-
-				Vector2i glyph_origin = Vector2i(box.origin);
-				Vector2i glyph_dimensions = Vector2i(box.dimensions);
-
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					box.origin = Vector2f(glyph_origin);
-				else
-					box.texture_index = -1;
+				ApplyEffectToClonedBox(it->second, glyph);
 			}
 		}
 	}
@@ -125,8 +123,6 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 			texture_layout.AddRectangle((int)character, glyph_dimensions);
 		}
 
-		constexpr int max_texture_dimensions = 1024;
-
 		// Generate the texture layout; this will position the glyph rectangles efficiently and
 		// allocate the texture data ready for writing.
 		if (!texture_layout.GenerateLayout(max_texture_dimensions))
@@ -137,57 +133,146 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 		{
 			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
 			Character character = (Character)rectangle.GetId();
 			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+			PlaceBox(character_boxes[character], rectangle);
 		}
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
-
 		// Generate the textures.
 		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+			textures.push_back(MakeUnique<Texture>(CreateTexture(handle, i)));
+	}
+
+	return true;
+}
+
+bool FontFaceLayer::AppendGlyph(const FontFaceHandleDefault* handle, Character character, const FontFaceLayer* clone, bool clone_glyph_origins)
+{
+	const FontGlyphMap& glyphs = handle->GetGlyphs();
+	auto it_glyph = glyphs.find(character);
+	if (it_glyph == glyphs.end())
+		return false;
+
+	const FontGlyph& glyph = it_glyph->second;
+
+	if (clone)
+	{
+		auto it_box = clone->character_boxes.find(character);
+		if (it_box != clone->character_boxes.end())
 		{
-			const int texture_id = i;
-
-			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](RenderInterface* render_interface,
-												   const String& /*name*/, TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
-				UniquePtr<const byte[]> data;
-				if (!handle->GenerateLayerTexture(data, out_dimensions, effect_ptr, texture_id, handle_version) || !data)
-					return false;
-				if (!render_interface->GenerateTexture(out_texture_handle, data.get(), out_dimensions))
-					return false;
-				return true;
-			};
-
-			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
-			textures.push_back(texture);
+			TextureBox box = it_box->second;
+			if (effect && !clone_glyph_origins)
+				ApplyEffectToClonedBox(box, glyph);
+			character_boxes[character] = box;
 		}
+
+		// Share any textures added to the cloned layer.
+		for (size_t i = textures.size(); i < clone->textures.size(); ++i)
+			textures.push_back(MakeUnique<Texture>(*clone->textures[i]));
+
+		return true;
+	}
+
+	Vector2i glyph_origin(0, 0);
+	Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+
+	if (effect)
+	{
+		if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+			return true;
 	}
 
+	const int rectangle_index = texture_layout.InsertRectangle((int)character, glyph_dimensions, max_texture_dimensions);
+	if (rectangle_index < 0)
+		return false;
+
+	TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(rectangle_index);
+
+	TextureBox& box = character_boxes[character];
+	box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+	box.dimensions = Vector2f(glyph_dimensions);
+	PlaceBox(box, rectangle);
+
+	// New textures are generated on first use, including the glyph.
+	if (box.texture_index == GetNumTextures())
+	{
+		textures.push_back(MakeUnique<Texture>(CreateTexture(handle, box.texture_index)));
+		return true;
+	}
+
+	if (glyph_dimensions.x == 0 || glyph_dimensions.y == 0)
+		return true;
+
+	const TextureHandle texture_handle = textures[box.texture_index]->GetHandle();
+	RenderInterface* render_interface = RenderCommandList::GetActiveRenderInterface();
+	if (!texture_handle || !render_interface)
+		return false;
+
+	// Upload only the glyph's region of the texture, the rest of the texture and existing texture coordinates stay valid.
+	const int stride = glyph_dimensions.x * 4;
+	UniquePtr<byte[]> data(new byte[stride * glyph_dimensions.y]);
+	for (int i = 0; i < glyph_dimensions.x * glyph_dimensions.y; i++)
+		((unsigned int*)(data.get()))[i] = 0x00ffffff;
+
+	WriteGlyph(data.get(), stride, box, glyph);
+
+	return render_interface->UpdateTexture(texture_handle, data.get(), Rectanglei::FromPositionSize(rectangle.GetPosition(), glyph_dimensions));
+}
+
+bool FontFaceLayer::GenerateDistanceField(const FontFaceLayer* source, float scale)
+{
+	texture_layout = TextureLayout{};
+	character_boxes.clear();
+	textures.clear();
+
+	distance_field_source = source;
+	distance_field_scale = scale;
+
+	float width = 0.f;
+	float softness = 0.f;
+	Vector2i offset;
+	if (effect && !effect->GetDistanceFieldParameters(width, softness, offset))
+		return false;
+
+	// Convert the distances to pixels at the size of the source, they cannot reach further than its distance fields.
+	const float spread = float(FontDistanceField::spread);
+	width = Math::Min(width / scale, spread);
+	softness = Math::Min(softness / scale, spread - width);
+
+	distance_field_offset = Vector2f(offset);
+	distance_field_edge = FontDistanceField::GetValue(-width);
+	distance_field_softness = FontDistanceField::GetValue(softness) - FontDistanceField::GetValue(0.f);
+
+	AppendDistanceFieldTextures();
+
 	return true;
 }
 
+void FontFaceLayer::AppendDistanceFieldTextures()
+{
+	if (!distance_field_source)
+		return;
+
+	for (size_t i = textures.size(); i < distance_field_source->textures.size(); ++i)
+		textures.push_back(MakeUnique<Texture>(CreateDistanceFieldTexture(*distance_field_source->textures[i])));
+}
+
 bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
 {
 	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
 		return false;
 
 	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
+	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture(texture_layout);
 	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
 
+	struct GlyphTask {
+		TextureLayoutRectangle* rectangle;
+		const TextureBox* box;
+		const FontGlyph* glyph;
+	};
+	Vector<GlyphTask> glyph_tasks;
+
 	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 	{
 		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
@@ -203,46 +288,123 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 		if (it == glyphs.end())
 			continue;
 
-		const FontGlyph& glyph = it->second;
+		glyph_tasks.push_back(GlyphTask{&rectangle, &box, &it->second});
+	}
+
+	// Each glyph is written to its own region of the texture, so the glyphs and their effects can be generated in parallel.
+	GetTaskInterface()->ParallelFor((int)glyph_tasks.size(), [this, &glyph_tasks](int i) {
+		const GlyphTask& task = glyph_tasks[i];
+		WriteGlyph(task.rectangle->GetTextureData(), task.rectangle->GetTextureStride(), *task.box, *task.glyph);
+	});
+
+	return true;
+}
+
+bool FontFaceLayer::ApplyEffectToClonedBox(TextureBox& box, const FontGlyph& glyph) const
+{
+	Vector2i glyph_origin = Vector2i(box.origin);
+	Vector2i glyph_dimensions = Vector2i(box.dimensions);
+
+	if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+	{
+		box.texture_index = -1;
+		return false;
+	}
+
+	box.origin = Vector2f(glyph_origin);
+	return true;
+}
 
-		if (effect == nullptr)
+void FontFaceLayer::PlaceBox(TextureBox& box, TextureLayoutRectangle& rectangle)
+{
+	const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
+
+	// Set the character's texture index.
+	box.texture_index = rectangle.GetTextureIndex();
+
+	// Generate the character's texture coordinates.
+	box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
+	box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
+	box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
+	box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+}
+
+void FontFaceLayer::WriteGlyph(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const
+{
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
+				{
+				case ColorFormat::A8:
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							destination[k * 4 + 3] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						destination[k * 4 + 3] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
+				{
+					memcpy(destination, source, num_bytes_per_line);
+				}
+				break;
 				}
+
+				destination += stride;
+				source += num_bytes_per_line;
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
 	}
+	else
+	{
+		effect->GenerateGlyphTexture(destination, Vector2i(box.dimensions), stride, glyph);
+	}
+}
 
-	return true;
+Texture FontFaceLayer::CreateTexture(const FontFaceHandleDefault* handle, int texture_id) const
+{
+	const FontEffect* effect_ptr = effect.get();
+	const int handle_version = handle->GetVersion();
+
+	TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](RenderInterface* render_interface, const String& /*name*/,
+										   TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
+		UniquePtr<const byte[]> data;
+		if (!handle->GenerateLayerTexture(data, out_dimensions, effect_ptr, texture_id, handle_version) || !data)
+			return false;
+		if (!render_interface->GenerateTexture(out_texture_handle, data.get(), out_dimensions))
+			return false;
+		return true;
+	};
+
+	Texture texture;
+	texture.Set("font-face-layer", texture_callback);
+	return texture;
+}
+
+Texture FontFaceLayer::CreateDistanceFieldTexture(const Texture& source_texture) const
+{
+	const float edge = distance_field_edge;
+	const float softness = distance_field_softness;
+
+	TextureCallback texture_callback = [source_texture, edge, softness](RenderInterface* render_interface, const String& /*name*/,
+										   TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
+		const TextureHandle source_handle = source_texture.GetHandle();
+		if (!source_handle)
+			return false;
+		out_texture_handle = render_interface->CreateDistanceFieldTexture(source_handle, edge, softness);
+		out_dimensions = source_texture.GetDimensions();
+		return out_texture_handle != 0;
+	};
+
+	Texture texture;
+	texture.Set("font-face-layer-distance-field", texture_callback);
+	return texture;
 }
 
 const FontEffect* FontFaceLayer::GetFontEffect() const
@@ -255,7 +417,7 @@ const Texture* FontFaceLayer::GetTexture(int index)
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumTextures());
 
-	return &(textures[index]);
+	return textures[index].get();
 }
 
 int FontFaceLayer::GetNumTextures() const
@@ -263,6 +425,22 @@ int FontFaceLayer::GetNumTextures() const
 	return (int)textures.size();
 }
 
+int FontFaceLayer::GetNumGeneratedTextures() const
+{
+	return texture_layout.GetNumTextures();
+}
+
+size_t FontFaceLayer::GetGeneratedTextureBytes() const
+{
+	size_t result = 0;
+	for (int i = 0; i < texture_layout.GetNumTextures(); i++)
+	{
+		const Vector2i dimensions = texture_layout.GetTexture(i).GetDimensions();
+		result += size_t(dimensions.x) * size_t(dimensions.y) * 4;
+	}
+	return result;
+}
+
 Colourb FontFaceLayer::GetColour() const
 {
 	return colour;
@@ -59,6 +59,25 @@ public:
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
+	/// Adds a new glyph to the generated layer, without moving existing glyphs or regenerating their textures. The glyph is placed in the
+	/// free space of the layer's textures, or on a new texture, and only its region is uploaded to loaded textures.
+	/// @param[in] handle The handle generating this layer, which must contain the glyph.
+	/// @param[in] character The character of the new glyph.
+	/// @param[in] clone The layer to optionally clone the glyph from, which must already contain the glyph.
+	/// @param[in] clone_glyph_origins True to keep the glyph origin of the cloned layer.
+	/// @return True if the glyph was added, false if the layer needs to be generated again.
+	bool AppendGlyph(const FontFaceHandleDefault* handle, Character character, const FontFaceLayer* clone = nullptr,
+		bool clone_glyph_origins = false);
+
+	/// Generates or re-generates the layer to render the glyphs of another layer from its distance field textures, scaled to our size.
+	/// @param[in] source The base layer of the handle with the distance field atlas.
+	/// @param[in] scale The size of our handle relative to the size of the atlas.
+	/// @return True if the layer was generated, false if its effect cannot be rendered from distance fields.
+	bool GenerateDistanceField(const FontFaceLayer* source, float scale);
+
+	/// Adds any new textures of the distance field source layer to the layer, after glyphs were appended to the source.
+	void AppendDistanceFieldTextures();
+
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
@@ -73,8 +92,9 @@ public:
 	/// @param[in] colour The colour of the string.
 	inline void GenerateGeometry(Geometry* geometry, const Character character_code, const Vector2f position, const Colourb colour) const
 	{
-		auto it = character_boxes.find(character_code);
-		if (it == character_boxes.end())
+		const CharacterMap& boxes = (distance_field_source ? distance_field_source->character_boxes : character_boxes);
+		auto it = boxes.find(character_code);
+		if (it == boxes.end())
 			return;
 
 		const TextureBox& box = it->second;
@@ -82,6 +102,19 @@ public:
 		if (box.texture_index < 0)
 			return;
 
+		// Distance fields are scaled from the size of their source layer, and can be rendered at fractional positions.
+		Vector2f box_position, box_dimensions;
+		if (distance_field_source)
+		{
+			box_position = position + box.origin * distance_field_scale + distance_field_offset;
+			box_dimensions = box.dimensions * distance_field_scale;
+		}
+		else
+		{
+			box_position = Vector2f(position.x + box.origin.x, position.y + box.origin.y).Round();
+			box_dimensions = box.dimensions;
+		}
+
 		// Generate the geometry for the character.
 		Vector<Vertex>& character_vertices = geometry[box.texture_index].GetVertices();
 		Vector<int>& character_indices = geometry[box.texture_index].GetIndices();
@@ -89,8 +122,8 @@ public:
 		character_vertices.resize(character_vertices.size() + 4);
 		character_indices.resize(character_indices.size() + 6);
 		GeometryUtilities::GenerateQuad(&character_vertices[0] + (character_vertices.size() - 4),
-			&character_indices[0] + (character_indices.size() - 6), Vector2f(position.x + box.origin.x, position.y + box.origin.y).Round(),
-			box.dimensions, colour, box.texcoords[0], box.texcoords[1], (int)character_vertices.size() - 4);
+			&character_indices[0] + (character_indices.size() - 6), box_position, box_dimensions, colour, box.texcoords[0], box.texcoords[1],
+			(int)character_vertices.size() - 4);
 	}
 
 	/// Returns the effect used to generate the layer.
@@ -101,6 +134,11 @@ public:
 	/// Returns the number of textures employed by this layer.
 	int GetNumTextures() const;
 
+	/// Returns the number of textures generated by this layer, excluding any textures shared with a cloned layer.
+	int GetNumGeneratedTextures() const;
+	/// Returns the size in bytes of the textures generated by this layer.
+	size_t GetGeneratedTextureBytes() const;
+
 	/// Returns the layer's colour.
 	Colourb GetColour() const;
 
@@ -120,7 +158,19 @@ private:
 	};
 
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
-	using TextureList = Vector<Texture>;
+	// Geometry refers to the textures by pointer, thus they must not move when new textures are appended.
+	using TextureList = Vector<UniquePtr<Texture>>;
+
+	// Applies the effect's glyph metrics to a box cloned from another layer. Returns false if the effect does not apply to the glyph.
+	bool ApplyEffectToClonedBox(TextureBox& box, const FontGlyph& glyph) const;
+	// Sets the texture index and texture coordinates of a box from its placed rectangle.
+	void PlaceBox(TextureBox& box, TextureLayoutRectangle& rectangle);
+	// Writes the glyph's pixels for this layer into the destination, using the given stride in bytes.
+	void WriteGlyph(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const;
+	// Creates a texture which generates its data from the texture layout on first use.
+	Texture CreateTexture(const FontFaceHandleDefault* handle, int texture_id) const;
+	// Creates a texture which renders the given texture as a distance field using the parameters of this layer.
+	Texture CreateDistanceFieldTexture(const Texture& source_texture) const;
 
 	SharedPtr<const FontEffect> effect;
 
@@ -129,6 +179,14 @@ private:
 	CharacterMap character_boxes;
 	TextureList textures;
 	Colourb colour;
+
+	// The layer whose glyph boxes and textures are rendered as distance fields by this layer, if any.
+	const FontFaceLayer* distance_field_source = nullptr;
+	float distance_field_scale = 1.f;
+	Vector2f distance_field_offset;
+	// The normalized distance field value at the edge, and the distance over which the edge fades on each side.
+	float distance_field_edge = 0.f;
+	float distance_field_softness = 0.f;
 };
 
 } // namespace Rml
@@ -0,0 +1,131 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontGlyphCache.h"
+#include "../../../Include/RmlUi/Core/Profiling.h"
+#include "FontFaceHandleDefault.h"
+#include <algorithm>
+
+namespace Rml {
+
+static size_t budget = 0;
+static uint64_t current_tick = 0;
+// Trimming only has an effect after glyphs were used, or the budget or the handles changed since it was last attempted. This way the cache is
+// trimmed at most once per frame, even though it is shared by all contexts.
+static bool trim_pending = true;
+static Vector<FontFaceHandleDefault*> handles;
+
+void FontGlyphCache::SetBudget(size_t budget_bytes)
+{
+	budget = budget_bytes;
+	trim_pending = true;
+}
+
+bool FontGlyphCache::IsEnabled()
+{
+	return budget > 0;
+}
+
+uint64_t FontGlyphCache::NextTick()
+{
+	trim_pending = true;
+	return ++current_tick;
+}
+
+uint64_t FontGlyphCache::GetTick()
+{
+	return current_tick;
+}
+
+bool FontGlyphCache::Trim()
+{
+	if (!IsEnabled() || !trim_pending)
+		return false;
+
+	RMLUI_ZoneScoped;
+	trim_pending = false;
+
+	const FontGlyphCacheStatistics statistics = GetStatistics();
+	if (statistics.texture_bytes <= budget)
+		return false;
+
+	Vector<FontFaceHandleDefault::ColdGlyph> cold_glyphs;
+	for (FontFaceHandleDefault* handle : handles)
+		handle->GetColdGlyphs(cold_glyphs);
+
+	std::sort(cold_glyphs.begin(), cold_glyphs.end(),
+		[](const FontFaceHandleDefault::ColdGlyph& a, const FontFaceHandleDefault::ColdGlyph& b) { return a.last_used < b.last_used; });
+
+	// Evict the least recently used glyphs until their estimated texture area brings us within budget.
+	const size_t bytes_to_evict = statistics.texture_bytes - budget;
+	size_t bytes_evicted = 0;
+	size_t num_evicted = 0;
+	for (; num_evicted < cold_glyphs.size() && bytes_evicted < bytes_to_evict; num_evicted++)
+		bytes_evicted += cold_glyphs[num_evicted].texture_bytes;
+
+	if (num_evicted == 0)
+		return false;
+
+	// Group the evicted glyphs by handle, so that each handle regenerates its layers only once.
+	std::stable_sort(cold_glyphs.begin(), cold_glyphs.begin() + num_evicted,
+		[](const FontFaceHandleDefault::ColdGlyph& a, const FontFaceHandleDefault::ColdGlyph& b) { return a.handle < b.handle; });
+
+	Vector<Character> characters;
+	for (size_t i = 0; i < num_evicted; i++)
+	{
+		characters.push_back(cold_glyphs[i].character);
+		if (i + 1 == num_evicted || cold_glyphs[i + 1].handle != cold_glyphs[i].handle)
+		{
+			cold_glyphs[i].handle->EvictGlyphs(characters);
+			characters.clear();
+		}
+	}
+
+	return true;
+}
+
+FontGlyphCacheStatistics FontGlyphCache::GetStatistics()
+{
+	FontGlyphCacheStatistics statistics;
+	for (FontFaceHandleDefault* handle : handles)
+		handle->AddGlyphCacheStatistics(statistics);
+	return statistics;
+}
+
+void FontGlyphCache::AddHandle(FontFaceHandleDefault* handle)
+{
+	handles.push_back(handle);
+	trim_pending = true;
+}
+
+void FontGlyphCache::RemoveHandle(FontFaceHandleDefault* handle)
+{
+	handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+}
+
+} // namespace Rml
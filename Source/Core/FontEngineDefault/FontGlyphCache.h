@@ -0,0 +1,73 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHCACHE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHCACHE_H
+
+#include "../../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class FontFaceHandleDefault;
+
+/**
+    Tracks the glyphs of all font face handles, and evicts the least recently used glyphs when their textures exceed a global budget.
+
+    Glyphs are marked as used whenever string geometry is generated with them. Regenerating the layers of a handle invalidates all of
+    its string geometry, so glyphs which have not been used since then are not displayed anywhere and can be evicted. Evicting glyphs
+    from a handle regenerates its layers from the remaining glyphs, thereby releasing any textures no longer needed.
+ */
+
+class FontGlyphCache {
+public:
+	/// Sets the maximum size of all glyph textures in bytes, or zero for no limit.
+	static void SetBudget(size_t budget_bytes);
+	/// Returns true if a budget is set.
+	static bool IsEnabled();
+
+	/// Returns a new usage tick, later ticks denote more recent use.
+	static uint64_t NextTick();
+	/// Returns the most recent usage tick.
+	static uint64_t GetTick();
+
+	/// Evicts the least recently used glyphs not in use while over budget. Does nothing unless glyphs were used, or the budget or the
+	/// handles changed, since the last call.
+	/// @return True if any glyphs were evicted.
+	static bool Trim();
+
+	/// Returns statistics of the glyphs of all font face handles.
+	static FontGlyphCacheStatistics GetStatistics();
+
+	/// Adds or removes font face handles to be tracked by the cache.
+	static void AddHandle(FontFaceHandleDefault* handle);
+	static void RemoveHandle(FontFaceHandleDefault* handle);
+};
+
+} // namespace Rml
+#endif
@@ -31,6 +31,7 @@
 #include "../../../Include/RmlUi/Core/FileInterface.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Math.h"
+#include "../../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../ComputeProperty.h"
 #include "FontFace.h"
@@ -103,6 +104,16 @@ FontFaceHandleDefault* FontProvider::GetFallbackFontFace(int index, int font_siz
 	return nullptr;
 }
 
+FontFaceHandleDefault* FontProvider::GetFallbackDistanceFieldAtlas(int index)
+{
+	auto& faces = FontProvider::Get().fallback_font_faces;
+
+	if (index >= 0 && index < (int)faces.size())
+		return faces[index]->GetDistanceFieldAtlas();
+
+	return nullptr;
+}
+
 void FontProvider::ReleaseFontResources()
 {
 	RMLUI_ASSERT(g_font_provider);
@@ -110,6 +121,17 @@ void FontProvider::ReleaseFontResources()
 		name_family.second->ReleaseFontResources();
 }
 
+void FontProvider::SetDistanceFieldEnabled(bool enable)
+{
+	FontProvider::Get().distance_field_enabled = enable;
+}
+
+bool FontProvider::IsDistanceFieldEnabled()
+{
+	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	return FontProvider::Get().distance_field_enabled && render_interface && render_interface->SupportsDistanceFieldTextures();
+}
+
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
 {
 	FileInterface* file_interface = GetFileInterface();
@@ -72,9 +72,17 @@ public:
 	/// Return a font face handle with the given index, at the given font size.
 	static FontFaceHandleDefault* GetFallbackFontFace(int index, int font_size);
 
+	/// Return the distance field atlas of the fallback font face with the given index.
+	static FontFaceHandleDefault* GetFallbackDistanceFieldAtlas(int index);
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
+	/// Enables rendering new font face handles from distance fields, if supported by the render interface.
+	static void SetDistanceFieldEnabled(bool enable);
+	/// Returns true if new font face handles should be rendered from distance fields.
+	static bool IsDistanceFieldEnabled();
+
 private:
 	FontProvider();
 	~FontProvider();
@@ -93,6 +101,8 @@ private:
 	FontFamilyMap font_families;
 	FontFaceList fallback_font_faces;
 
+	bool distance_field_enabled = false;
+
 	static const String debugger_font_family_name;
 };
 
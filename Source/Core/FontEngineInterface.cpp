@@ -80,4 +80,18 @@ int FontEngineInterface::GetVersion(FontFaceHandle /*handle*/)
 
 void FontEngineInterface::ReleaseFontResources() {}
 
+void FontEngineInterface::SetGlyphCacheBudget(size_t /*budget_bytes*/) {}
+
+bool FontEngineInterface::TrimGlyphCache()
+{
+	return false;
+}
+
+FontGlyphCacheStatistics FontEngineInterface::GetGlyphCacheStatistics()
+{
+	return {};
+}
+
+void FontEngineInterface::SetDistanceFieldFonts(bool /*enable*/) {}
+
 } // namespace Rml
@@ -33,19 +33,20 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "GeometryDatabase.h"
+#include "RenderCommandList.h"
 #include <utility>
 
 namespace Rml {
 
 Geometry::Geometry()
 {
-	database_handle = GeometryDatabase::Insert(this);
+	database_handle = GeometryDatabase::Insert(this, vertices, indices);
 }
 
 Geometry::Geometry(Geometry&& other) noexcept
 {
+	database_handle = GeometryDatabase::Insert(this, vertices, indices);
 	MoveFrom(other);
-	database_handle = GeometryDatabase::Insert(this);
 }
 
 Geometry& Geometry::operator=(Geometry&& other) noexcept
@@ -57,8 +58,11 @@ Geometry& Geometry::operator=(Geometry&& other) noexcept
 
 void Geometry::MoveFrom(Geometry& other) noexcept
 {
-	vertices = std::move(other.vertices);
-	indices = std::move(other.indices);
+	// Swap the buffers so that any memory reserved by our old buffers is kept in the database.
+	std::swap(*vertices, *other.vertices);
+	std::swap(*indices, *other.indices);
+	other.vertices->clear();
+	other.indices->clear();
 
 	texture = std::exchange(other.texture, nullptr);
 
@@ -75,7 +79,7 @@ Geometry::~Geometry()
 
 void Geometry::Render(Vector2f translation)
 {
-	RenderInterface* const render_interface = ::Rml::GetRenderInterface();
+	RenderInterface* const render_interface = RenderCommandList::GetActiveRenderInterface();
 	RMLUI_ASSERT(render_interface);
 
 	translation = translation.Round();
@@ -90,16 +94,17 @@ void Geometry::Render(Vector2f translation)
 	// immediate mode.
 	else
 	{
-		if (vertices.empty() || indices.empty())
+		if (vertices->empty() || indices->empty())
 			return;
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
-		if (!compile_attempted)
+		// The recorder keeps geometry uncompiled so that it can be merged, only attempt to compile once rendered outside of a recording.
+		if (!compile_attempted && !RenderCommandList::GetRecordingInterface())
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(),
-				texture ? texture->GetHandle() : 0);
+			compiled_geometry = RenderCommandList::CompileGeometry(render_interface, vertices->data(), (int)vertices->size(), indices->data(),
+				(int)indices->size(), texture ? texture->GetHandle() : 0);
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
@@ -112,19 +117,19 @@ void Geometry::Render(Vector2f translation)
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle() : 0,
-			translation);
+		RenderCommandList::RenderGeometry(render_interface, vertices->data(), (int)vertices->size(), indices->data(), (int)indices->size(),
+			texture ? texture->GetHandle() : 0, translation);
 	}
 }
 
 Vector<Vertex>& Geometry::GetVertices()
 {
-	return vertices;
+	return *vertices;
 }
 
 Vector<int>& Geometry::GetIndices()
 {
-	return indices;
+	return *indices;
 }
 
 const Texture* Geometry::GetTexture() const
@@ -142,7 +147,7 @@ void Geometry::Release(bool clear_buffers)
 {
 	if (compiled_geometry)
 	{
-		::Rml::GetRenderInterface()->ReleaseCompiledGeometry(compiled_geometry);
+		RenderCommandList::ReleaseGeometry(compiled_geometry);
 		compiled_geometry = 0;
 	}
 
@@ -150,14 +155,14 @@ void Geometry::Release(bool clear_buffers)
 
 	if (clear_buffers)
 	{
-		vertices.clear();
-		indices.clear();
+		vertices->clear();
+		indices->clear();
 	}
 }
 
 Geometry::operator bool() const
 {
-	return !indices.empty();
+	return !indices->empty();
 }
 
 } // namespace Rml
@@ -29,91 +29,172 @@
 #include "GeometryDatabase.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include <algorithm>
+#include <iterator>
 
 namespace Rml {
 namespace GeometryDatabase {
 
 	class Database {
 	public:
-		Database()
-		{
-			constexpr size_t reserve_size = 512;
-			geometry_list.reserve(reserve_size);
-			free_list.reserve(reserve_size);
-		}
+		Database() { free_list.reserve(page_size); }
 
 		~Database()
 		{
 #ifdef RMLUI_TESTS_ENABLED
-			RMLUI_ASSERT(geometry_list.size() == free_list.size());
-			std::sort(free_list.begin(), free_list.end());
-			for (size_t i = 0; i < free_list.size(); i++)
-			{
-				RMLUI_ASSERT(i == free_list[i]);
-			}
+			RMLUI_ASSERT(size() == 0);
+			RMLUI_ASSERT(free_list.size() == pages.size() * page_size);
 #endif
 		}
 
-		GeometryDatabaseHandle insert(Geometry* value)
+		GeometryDatabaseHandle insert(Geometry* value, Vector<Vertex>*& out_vertices, Vector<int>*& out_indices)
 		{
-			GeometryDatabaseHandle handle;
 			if (free_list.empty())
-			{
-				handle = GeometryDatabaseHandle(geometry_list.size());
-				geometry_list.push_back(value);
-			}
-			else
-			{
-				handle = free_list.back();
-				free_list.pop_back();
-				geometry_list[handle] = value;
-			}
+				add_page();
+
+			// The most recently freed slot is reused first, as its buffers are the most likely to have memory reserved.
+			const GeometryDatabaseHandle handle = free_list.back();
+			free_list.pop_back();
+
+			Slot& slot = get_slot(handle);
+			RMLUI_ASSERT(!slot.geometry && slot.vertices.empty() && slot.indices.empty());
+			slot.geometry = value;
+			out_vertices = &slot.vertices;
+			out_indices = &slot.indices;
 			return handle;
 		}
 
-		int size() const { return (int)geometry_list.size() - (int)free_list.size(); }
+		void erase(GeometryDatabaseHandle handle)
+		{
+			Slot& slot = get_slot(handle);
+			slot.geometry = nullptr;
+			slot.vertices.clear();
+			slot.indices.clear();
+
+			// Large buffers are released, as they would mostly be wasted on the typically small geometry reusing the slot.
+			if (slot.vertices.capacity() > max_retained_vertices)
+				Vector<Vertex>().swap(slot.vertices);
+			if (slot.indices.capacity() > max_retained_indices)
+				Vector<int>().swap(slot.indices);
+
+			free_list.push_back(handle);
+		}
+
+		int size() const { return int(pages.size() * page_size) - (int)free_list.size(); }
 
 		void clear()
 		{
-			geometry_list.clear();
+			RMLUI_ASSERT(size() == 0);
+			pages.clear();
 			free_list.clear();
 		}
-		void erase(GeometryDatabaseHandle handle) { free_list.push_back(handle); }
 
 		// Iterate over every item in the database, skipping free slots.
 		template <typename Func>
 		void for_each(Func&& func)
 		{
-			std::sort(free_list.begin(), free_list.end());
+			for (const UniquePtr<Page>& page : pages)
+			{
+				for (Slot& slot : page->slots)
+				{
+					if (slot.geometry)
+						func(slot.geometry);
+				}
+			}
+		}
 
-			size_t i_begin_next = 0;
-			for (GeometryDatabaseHandle freelist_entry : free_list)
+		GeometryMemoryStats get_stats() const
+		{
+			GeometryMemoryStats stats;
+			stats.num_pages = (int)pages.size();
+			stats.num_geometry = size();
+			stats.num_free_slots = (int)free_list.size();
+
+			for (const UniquePtr<Page>& page : pages)
 			{
-				const size_t i_end = size_t(freelist_entry);
-				const size_t i_begin = i_begin_next;
-				i_begin_next = i_end + 1;
+				for (const Slot& slot : page->slots)
+				{
+					stats.used_bytes += slot.vertices.size() * sizeof(Vertex) + slot.indices.size() * sizeof(int);
+					stats.reserved_bytes += slot.vertices.capacity() * sizeof(Vertex) + slot.indices.capacity() * sizeof(int);
+				}
+			}
 
-				for (size_t i = i_begin; i < i_end; i++)
-					func(geometry_list[i]);
+			return stats;
+		}
+
+		void compact()
+		{
+			for (const UniquePtr<Page>& page : pages)
+			{
+				for (Slot& slot : page->slots)
+				{
+					slot.vertices.shrink_to_fit();
+					slot.indices.shrink_to_fit();
+				}
 			}
 
-			for (size_t i = i_begin_next; i < geometry_list.size(); i++)
-				func(geometry_list[i]);
+			// Pages are only released from the back, as the slots of the remaining pages must keep their addresses.
+			size_t num_pages = pages.size();
+			while (num_pages > 0 && is_page_free(*pages[num_pages - 1]))
+				num_pages -= 1;
+
+			if (num_pages < pages.size())
+			{
+				pages.resize(num_pages);
+
+				const GeometryDatabaseHandle end_handle = GeometryDatabaseHandle(num_pages * page_size);
+				auto IsReleased = [end_handle](GeometryDatabaseHandle handle) { return handle >= end_handle; };
+				free_list.erase(std::remove_if(free_list.begin(), free_list.end(), IsReleased), free_list.end());
+			}
 		}
 
 	private:
-		// List of all active geometry, in addition to free slots.
-		// Free slots (as defined by the 'free_list') may contain dangling pointers and must not be dereferenced.
-		Vector<Geometry*> geometry_list;
-		// Declares free slots in the 'geometry_list' as indices.
+		static constexpr size_t page_size = 128;
+		// The largest buffer capacities kept for new geometry in free slots, enough for a few dozen quads.
+		static constexpr size_t max_retained_vertices = 256;
+		static constexpr size_t max_retained_indices = 384;
+
+		struct Slot {
+			// The geometry using this slot, or nullptr if the slot is free.
+			Geometry* geometry = nullptr;
+			Vector<Vertex> vertices;
+			Vector<int> indices;
+		};
+		struct Page {
+			Slot slots[page_size];
+		};
+
+		Slot& get_slot(GeometryDatabaseHandle handle)
+		{
+			RMLUI_ASSERT(size_t(handle) < pages.size() * page_size);
+			return pages[handle / page_size]->slots[handle % page_size];
+		}
+
+		static bool is_page_free(const Page& page)
+		{
+			return std::none_of(std::begin(page.slots), std::end(page.slots), [](const Slot& slot) { return slot.geometry != nullptr; });
+		}
+
+		void add_page()
+		{
+			const GeometryDatabaseHandle begin_handle = GeometryDatabaseHandle(pages.size() * page_size);
+			pages.push_back(MakeUnique<Page>());
+
+			// Add the new slots in reverse, so that they are used in order.
+			for (size_t i = page_size; i > 0; i--)
+				free_list.push_back(begin_handle + GeometryDatabaseHandle(i - 1));
+		}
+
+		// Pages of slots, each page is allocated separately so that the slots never move.
+		Vector<UniquePtr<Page>> pages;
+		// Declares free slots as indices into the pages.
 		Vector<GeometryDatabaseHandle> free_list;
 	};
 
 	static Database geometry_database;
 
-	GeometryDatabaseHandle Insert(Geometry* geometry)
+	GeometryDatabaseHandle Insert(Geometry* geometry, Vector<Vertex>*& out_vertices, Vector<int>*& out_indices)
 	{
-		return geometry_database.insert(geometry);
+		return geometry_database.insert(geometry, out_vertices, out_indices);
 	}
 
 	void Erase(GeometryDatabaseHandle handle)
@@ -126,6 +207,16 @@ namespace GeometryDatabase {
 		geometry_database.for_each([](Geometry* geometry) { geometry->Release(); });
 	}
 
+	GeometryMemoryStats GetStats()
+	{
+		return geometry_database.get_stats();
+	}
+
+	void Compact()
+	{
+		geometry_database.compact();
+	}
+
 #ifdef RMLUI_TESTS_ENABLED
 
 	bool PrepareForTests()
@@ -133,8 +224,7 @@ namespace GeometryDatabase {
 		if (geometry_database.size() > 0)
 			return false;
 
-		// Even with size()==0 we can have items in the geometry list which should all be duplicated by the free list.
-		// We want to clear them for the tests.
+		// Even with size()==0 we can have pages of free slots, we want to clear them for the tests.
 		geometry_database.clear();
 
 		return true;
@@ -29,7 +29,9 @@
 #ifndef RMLUI_CORE_GEOMETRYDATABASE_H
 #define RMLUI_CORE_GEOMETRYDATABASE_H
 
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
 #include <stdint.h>
 
 namespace Rml {
@@ -38,9 +40,11 @@ class Geometry;
 using GeometryDatabaseHandle = uint32_t;
 
 /**
-    The geometry database stores a reference to all active geometry.
+    The geometry database stores a reference to all active geometry, along with their vertex and index buffers.
 
-    The intention is for the user to be able to re-compile all geometry in use.
+    The intention is for the user to be able to re-compile all geometry in use. The buffers are stored in pages of slots, and the
+    slots of erased geometry are reused for new geometry, keeping their reserved memory to avoid reallocating the buffers. Buffers
+    which grew large release their memory when erased, so that free slots only hold on to small reservations.
 
     It is expected that every Insert() call is followed (at some later time) by
     exactly one Erase() call with the same handle value.
@@ -48,11 +52,16 @@ using GeometryDatabaseHandle = uint32_t;
 
 namespace GeometryDatabase {
 
-	GeometryDatabaseHandle Insert(Geometry* geometry);
+	// Inserts the geometry, and returns the buffers it should use for its vertices and indices.
+	GeometryDatabaseHandle Insert(Geometry* geometry, Vector<Vertex>*& out_vertices, Vector<int>*& out_indices);
 	void Erase(GeometryDatabaseHandle handle);
 
 	void ReleaseAll();
 
+	GeometryMemoryStats GetStats();
+	// Releases the memory reserved by free slots and excess capacity, along with any trailing pages without geometry.
+	void Compact();
+
 #ifdef RMLUI_TESTS_ENABLED
 	bool PrepareForTests();
 	bool ListMatchesDatabase(const Vector<Geometry>& geometry_list);
@@ -32,12 +32,16 @@
 #include "../../../Include/RmlUi/Core/ElementScroll.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "FormattingContext.h"
+#include "LayoutCache.h"
 #include "LayoutDetails.h"
 #include <algorithm>
 #include <cmath>
 
 namespace Rml {
 
+// Total number of absolutely positioned elements added to any container.
+static int num_absolute_elements_added = 0;
+
 void ContainerBox::ResetScrollbars(const Box& box)
 {
 	RMLUI_ASSERT(element);
@@ -56,6 +60,12 @@ void ContainerBox::AddAbsoluteElement(Element* element, Vector2f static_position
 {
 	// We may possibly be adding the same element from a previous layout iteration. If so, this ensures it is updated with the latest static position.
 	absolute_elements[element] = AbsoluteElement{static_position, static_relative_offset_parent};
+	num_absolute_elements_added += 1;
+}
+
+int ContainerBox::GetNumAbsoluteElementsAdded()
+{
+	return num_absolute_elements_added;
 }
 
 void ContainerBox::AddRelativeElement(Element* element)
@@ -128,6 +138,13 @@ ContainerBox::ContainerBox(Type type, Element* element, ContainerBox* parent_con
 {
 	if (element)
 	{
+		// The element is only considered a layout boundary if it is formatted as one, see FormattingContext.
+		element->layout_boundary = false;
+
+		// Any stored formatting is replaced by this one, it is only stored again if formatted independently, see FormattingContext.
+		if (element->layout_cache)
+			element->layout_cache->valid = false;
+
 		const auto& computed = element->GetComputedValues();
 		overflow_x = computed.overflow_x();
 		overflow_y = computed.overflow_y();
@@ -53,6 +53,11 @@ public:
 	// Adds a relatively positioned element which we act as a containing block for.
 	void AddRelativeElement(Element* element);
 
+	// Returns true if any absolutely positioned elements have been added that are not yet formatted.
+	bool HasAbsoluteElements() const { return !absolute_elements.empty(); }
+	// Returns the total number of absolutely positioned elements added to any container, used to detect if formatting a box adds any.
+	static int GetNumAbsoluteElementsAdded();
+
 	ContainerBox* GetParent() { return parent_container; }
 	Element* GetElement() { return element; }
 	Style::Position GetPositionProperty() const { return position_property; }
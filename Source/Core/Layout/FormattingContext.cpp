@@ -31,13 +31,37 @@
 #include "../../../Include/RmlUi/Core/Element.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "BlockFormattingContext.h"
+#include "ContainerBox.h"
 #include "FlexFormattingContext.h"
 #include "LayoutBox.h"
+#include "LayoutCache.h"
+#include "LayoutDetails.h"
 #include "ReplacedFormattingContext.h"
 #include "TableFormattingContext.h"
 
 namespace Rml {
 
+// Layout boundaries are elements establishing an independent formatting context, whose size only depends on their own properties and containing
+// block, and which contain all of their own overflow. Then changes to their contents can't affect the layout of anything outside them.
+static bool IsLayoutBoundary(Element* element, Vector2f containing_block)
+{
+	using namespace Style;
+	const ComputedValues& computed = element->GetComputedValues();
+
+	const Display display = computed.display();
+	if (display != Display::Block && display != Display::FlowRoot && display != Display::Flex)
+		return false;
+
+	if (computed.float_() != Float::None || computed.overflow_x() == Overflow::Visible || computed.overflow_y() == Overflow::Visible)
+		return false;
+
+	auto IsDefinite = [](LengthPercentageAuto size, float containing_block_size) {
+		return size.type == LengthPercentageAuto::Length || (size.type == LengthPercentageAuto::Percentage && containing_block_size >= 0.f);
+	};
+
+	return IsDefinite(computed.width(), containing_block.x) && IsDefinite(computed.height(), containing_block.y);
+}
+
 UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
 	FormattingContextType backup_context)
 {
@@ -66,15 +90,69 @@ UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_c
 		type = FormattingContextType::Block;
 	}
 
+	if (type == FormattingContextType::None)
+		return nullptr;
+
+	const Vector2f containing_block = LayoutDetails::GetContainingBlock(parent_container, computed.position()).size;
+
+	// Skip formatting if the element's layout is still in place from its last formatting under the same constraints.
+	if (element->layout_cache && element->layout_cache->Matches(type, containing_block, override_initial_box))
+		return MakeUnique<CachedBox>(element, *element->layout_cache);
+
+	const int num_absolute_elements_added = ContainerBox::GetNumAbsoluteElementsAdded();
+
+	UniquePtr<LayoutBox> layout_box;
+
 	switch (type)
 	{
-	case FormattingContextType::Block: return BlockFormattingContext::Format(parent_container, element, override_initial_box);
-	case FormattingContextType::Table: return TableFormattingContext::Format(parent_container, element, override_initial_box);
-	case FormattingContextType::Flex: return FlexFormattingContext::Format(parent_container, element, override_initial_box);
+	case FormattingContextType::Block: layout_box = BlockFormattingContext::Format(parent_container, element, override_initial_box); break;
+	case FormattingContextType::Table: layout_box = TableFormattingContext::Format(parent_container, element, override_initial_box); break;
+	case FormattingContextType::Flex: layout_box = FlexFormattingContext::Format(parent_container, element, override_initial_box); break;
 	case FormattingContextType::None: break;
 	}
 
-	return nullptr;
+	if (!layout_box)
+		return nullptr;
+
+	// Boxes sized by their parent formatting context, such as flex items and table cells, can't act as layout boundaries.
+	if (!override_initial_box && IsLayoutBoundary(element, containing_block))
+	{
+		element->layout_boundary = true;
+		element->layout_boundary_containing_block = containing_block;
+	}
+
+	// The result can only be reused if formatting had no effect outside the element, which is not the case if any absolutely positioned
+	// descendants were added to an outer containing block.
+	const bool contains_absolute_elements =
+		(computed.position() != Position::Static || computed.has_local_transform() || computed.has_local_perspective());
+	if (!contains_absolute_elements && ContainerBox::GetNumAbsoluteElementsAdded() != num_absolute_elements_added)
+	{
+		if (element->layout_cache)
+			element->layout_cache->valid = false;
+		return layout_box;
+	}
+
+	if (!element->layout_cache)
+		element->layout_cache = MakeUnique<LayoutCache>();
+	element->layout_cache->Store(type, containing_block, override_initial_box, *layout_box);
+
+	// Return the compact cached box, so that the full box tree can be released immediately.
+	return MakeUnique<CachedBox>(element, *element->layout_cache);
+}
+
+bool FormattingContext::FormatLayoutBoundary(Element* element)
+{
+	RMLUI_ZoneScopedC(0xAFAFAF);
+
+	const Vector2f containing_block = element->layout_boundary_containing_block;
+	if (!element->layout_boundary || !IsLayoutBoundary(element, containing_block))
+		return false;
+
+	RootBox root(containing_block);
+	UniquePtr<LayoutBox> layout_box = FormatIndependent(&root, element, nullptr, FormattingContextType::Block);
+
+	// Absolutely positioned descendants escaping the boundary must be placed by an outer containing block.
+	return layout_box && !root.HasAbsoluteElements();
 }
 
 } // namespace Rml
@@ -58,6 +58,11 @@ public:
 	static UniquePtr<LayoutBox> FormatIndependent(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
 		FormattingContextType backup_context);
 
+	/// Format a layout boundary again in isolation, using the same containing block as in its last formatting.
+	/// @param[in] element The element to be formatted.
+	/// @return True on success, or false if the element is no longer a layout boundary, or if any of its contents depend on outer boxes.
+	static bool FormatLayoutBoundary(Element* element);
+
 protected:
 	FormattingContext() = default;
 	~FormattingContext() = default;
@@ -0,0 +1,92 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LayoutCache.h"
+#include "LayoutDetails.h"
+
+namespace Rml {
+
+bool LayoutCache::Matches(FormattingContextType _type, Vector2f _containing_block, const Box* _override_initial_box) const
+{
+	if (!valid || type != _type || containing_block != _containing_block)
+		return false;
+
+	if (_override_initial_box)
+		return has_override_initial_box && override_initial_box == *_override_initial_box;
+
+	return !has_override_initial_box;
+}
+
+void LayoutCache::Store(FormattingContextType _type, Vector2f _containing_block, const Box* _override_initial_box, const LayoutBox& layout_box)
+{
+	type = _type;
+	containing_block = _containing_block;
+	has_override_initial_box = (_override_initial_box != nullptr);
+	override_initial_box = (_override_initial_box ? *_override_initial_box : Box());
+
+	const Box* layout_box_box = layout_box.GetIfBox();
+	has_box = (layout_box_box != nullptr);
+	box = (layout_box_box ? *layout_box_box : Box());
+
+	visible_overflow_size = layout_box.GetVisibleOverflowSize();
+	has_baseline = layout_box.GetBaselineOfLastLine(baseline);
+	shrink_to_fit_width = layout_box.GetShrinkToFitWidth();
+
+	valid = true;
+}
+
+CachedBox::CachedBox(Element* element, const LayoutCache& cache) :
+	LayoutBox(Type::Cached), element(element), box(cache.box), baseline(cache.baseline), shrink_to_fit_width(cache.shrink_to_fit_width),
+	has_box(cache.has_box), has_baseline(cache.has_baseline)
+{
+	SetVisibleOverflowSize(cache.visible_overflow_size);
+}
+
+const Box* CachedBox::GetIfBox() const
+{
+	return has_box ? &box : nullptr;
+}
+
+bool CachedBox::GetBaselineOfLastLine(float& out_baseline) const
+{
+	if (has_baseline)
+		out_baseline = baseline;
+	return has_baseline;
+}
+
+float CachedBox::GetShrinkToFitWidth() const
+{
+	return shrink_to_fit_width;
+}
+
+String CachedBox::DebugDumpTree(int depth) const
+{
+	return String(depth * 2, ' ') + "CachedBox" + " | " + LayoutDetails::GetDebugElementName(element);
+}
+
+} // namespace Rml
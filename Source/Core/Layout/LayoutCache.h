@@ -0,0 +1,93 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_LAYOUT_LAYOUTCACHE_H
+#define RMLUI_CORE_LAYOUT_LAYOUTCACHE_H
+
+#include "../../../Include/RmlUi/Core/Box.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FormattingContext.h"
+#include "LayoutBox.h"
+
+namespace Rml {
+
+/*
+    The result of an element's last independent formatting, stored on the element.
+
+    The element's layout is left in place from that formatting. Thus, the result can be reused instead of formatting the element again, as long as
+    it is formatted under the same constraints, and neither the element nor any of its descendants have dirtied their layout since.
+*/
+struct LayoutCache {
+	// Returns true if the stored result is still valid and was formatted under the given constraints.
+	bool Matches(FormattingContextType type, Vector2f containing_block, const Box* override_initial_box) const;
+
+	// Stores the results of the given layout box, formatted under the given constraints.
+	void Store(FormattingContextType type, Vector2f containing_block, const Box* override_initial_box, const LayoutBox& layout_box);
+
+	// Constraints of the stored formatting.
+	FormattingContextType type = FormattingContextType::None;
+	Vector2f containing_block;
+	Box override_initial_box;
+	bool has_override_initial_box = false;
+
+	// Results of the stored formatting.
+	Box box;
+	Vector2f visible_overflow_size;
+	float baseline = 0.f;
+	float shrink_to_fit_width = 0.f;
+	bool has_box = false;
+	bool has_baseline = false;
+
+	// Cleared whenever the layout of the element or any of its descendants is dirtied, or it is formatted in any other way.
+	bool valid = false;
+};
+
+/*
+    A layout box representing an independently formatted element, using the results stored in its layout cache.
+*/
+class CachedBox final : public LayoutBox {
+public:
+	CachedBox(Element* element, const LayoutCache& cache);
+
+	const Box* GetIfBox() const override;
+	bool GetBaselineOfLastLine(float& out_baseline) const override;
+	float GetShrinkToFitWidth() const override;
+
+	String DebugDumpTree(int depth) const override;
+
+private:
+	Element* element;
+	Box box;
+	float baseline;
+	float shrink_to_fit_width;
+	bool has_box;
+	bool has_baseline;
+};
+
+} // namespace Rml
+#endif
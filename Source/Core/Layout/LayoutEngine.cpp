@@ -47,4 +47,10 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block)
 	}
 }
 
+bool LayoutEngine::FormatLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element);
+	return FormattingContext::FormatLayoutBoundary(element);
+}
+
 } // namespace Rml
@@ -47,6 +47,11 @@ public:
 	/// @param[in] element The element to lay out.
 	/// @param[in] containing_block The size of the containing block.
 	static void FormatElement(Element* element, Vector2f containing_block);
+
+	/// Formats a layout boundary in isolation, using the same containing block as during its last formatting.
+	/// @param[in] element The layout boundary to lay out.
+	/// @return False if the element can no longer be formatted in isolation, then its document must be formatted instead.
+	static bool FormatLayoutBoundary(Element* element);
 };
 
 } // namespace Rml
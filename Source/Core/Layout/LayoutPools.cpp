@@ -34,6 +34,7 @@
 #include "FormattingContext.h"
 #include "InlineBox.h"
 #include "InlineContainer.h"
+#include "LayoutCache.h"
 #include "LineBox.h"
 #include "ReplacedFormattingContext.h"
 #include <algorithm>
@@ -48,7 +49,7 @@ struct LayoutChunk {
 
 static constexpr std::size_t ChunkSizeBig = std::max({sizeof(BlockContainer)});
 static constexpr std::size_t ChunkSizeMedium =
-	std::max({sizeof(InlineContainer), sizeof(InlineBox), sizeof(RootBox), sizeof(FlexContainer), sizeof(TableWrapper)});
+	std::max({sizeof(InlineContainer), sizeof(InlineBox), sizeof(RootBox), sizeof(FlexContainer), sizeof(TableWrapper), sizeof(CachedBox)});
 static constexpr std::size_t ChunkSizeSmall =
 	std::max({sizeof(ReplacedBox), sizeof(InlineLevelBox_Text), sizeof(InlineLevelBox_Atomic), sizeof(LineBox), sizeof(FloatedBoxSpace)});
 
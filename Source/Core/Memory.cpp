@@ -88,7 +88,8 @@ namespace Detail {
 
 	BasicStackAllocator& GetGlobalBasicStackAllocator()
 	{
-		static BasicStackAllocator stack_allocator(10 * 1024);
+		// Each thread has its own allocator, so that e.g. font effects can be generated concurrently.
+		static thread_local BasicStackAllocator stack_allocator(10 * 1024);
 		return stack_allocator;
 	}
 
@@ -0,0 +1,640 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RenderCommandList.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <algorithm>
+#include <float.h>
+#include <string.h>
+
+namespace Rml {
+
+/**
+    Render interface which records all render calls into the currently recording command list.
+ */
+class RenderCommandRecorder final : public RenderInterface {
+public:
+	RenderCommandList* list = nullptr;
+
+	void RenderGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, TextureHandle texture,
+		const Vector2f& translation) override
+	{
+		list->RecordGeometry(vertices, num_vertices, indices, num_indices, texture, translation);
+	}
+
+	CompiledGeometryHandle CompileGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/,
+		TextureHandle /*texture*/) override
+	{
+		// Keep the geometry uncompiled so that it can be merged with adjacent geometry.
+		return 0;
+	}
+	void RenderCompiledGeometry(CompiledGeometryHandle geometry, const Vector2f& translation) override
+	{
+		list->RecordCompiledGeometry(geometry, translation);
+	}
+	void ReleaseCompiledGeometry(CompiledGeometryHandle geometry) override { list->pending_geometry_releases.push_back(geometry); }
+
+	void EnableScissorRegion(bool enable) override { list->commands.final_state.scissor_enabled = (enable ? 1 : 0); }
+	void SetScissorRegion(int x, int y, int width, int height) override
+	{
+		RenderCommandList::RenderState& state = list->commands.final_state;
+		state.scissor_region_set = true;
+		state.scissor_region = Rectanglei::FromPositionSize({x, y}, {width, height});
+	}
+
+	bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& source) override
+	{
+		return list->render_interface->LoadTexture(texture_handle, texture_dimensions, source);
+	}
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions) override
+	{
+		return list->render_interface->GenerateTexture(texture_handle, source, source_dimensions);
+	}
+	bool UpdateTexture(TextureHandle texture_handle, const byte* source, const Rectanglei& region) override
+	{
+		return list->render_interface->UpdateTexture(texture_handle, source, region);
+	}
+	void ReleaseTexture(TextureHandle texture) override { list->pending_texture_releases.push_back(texture); }
+	bool SupportsDistanceFieldTextures() override { return list->render_interface->SupportsDistanceFieldTextures(); }
+	TextureHandle CreateDistanceFieldTexture(TextureHandle texture, float edge, float softness) override
+	{
+		return list->render_interface->CreateDistanceFieldTexture(texture, edge, softness);
+	}
+
+	void SetTransform(const Matrix4f* transform) override
+	{
+		RenderCommandList::Commands& commands = list->commands;
+		RenderCommandList::RenderState& state = commands.final_state;
+		if (!transform)
+		{
+			state.transform = -1;
+		}
+		else if (state.transform < 0 || commands.transforms[state.transform] != *transform)
+		{
+			state.transform = (int)commands.transforms.size();
+			commands.transforms.push_back(*transform);
+		}
+	}
+};
+
+static RenderCommandRecorder* recorder = nullptr;
+static Vector<RenderCommandList*> command_lists;
+// The number of textures and geometry released through the command lists, used to tell whether recorded commands may refer to them.
+static uint32_t release_count = 0;
+
+// Bounds of geometry which cannot be determined, such as compiled geometry.
+static const Rectanglef unbounded = Rectanglef::FromCorners(Vector2f(-FLT_MAX), Vector2f(FLT_MAX));
+
+// Joins the bounds with the other rectangle, unless it has no area.
+static void JoinBounds(Rectanglef& bounds, Rectanglef other)
+{
+	if (!(other.Width() > 0.f && other.Height() > 0.f))
+		return;
+	if (bounds.Valid())
+		bounds.Join(other);
+	else
+		bounds = other;
+}
+
+RenderCommandList::RenderCommandList()
+{
+	command_lists.push_back(this);
+}
+
+RenderCommandList::~RenderCommandList()
+{
+	ReleaseCompiledGeometry();
+	command_lists.erase(std::find(command_lists.begin(), command_lists.end(), this));
+}
+
+void RenderCommandList::BeginRecording(RenderInterface* in_render_interface, bool in_track_bounds)
+{
+	RMLUI_ASSERT(in_render_interface && in_render_interface != recorder);
+	if (render_interface != in_render_interface)
+	{
+		ReleaseCompiledGeometry();
+		submitted_commands.Clear();
+		render_interface = in_render_interface;
+	}
+
+	if (!recorder)
+		recorder = new RenderCommandRecorder;
+
+	RMLUI_ASSERTMSG(!recorder->list, "Nested recording of render commands is not supported.");
+	recorder->list = this;
+	track_bounds = in_track_bounds;
+	recorded_release_count = release_count;
+	commands.Clear();
+}
+
+void RenderCommandList::EndRecording()
+{
+	RMLUI_ASSERT(recorder && recorder->list == this);
+	recorder->list = nullptr;
+	bounds_active = false;
+	recorded = true;
+}
+
+void RenderCommandList::PauseRecording()
+{
+	RMLUI_ASSERT(recorder && recorder->list == this);
+	recorder->list = nullptr;
+}
+
+void RenderCommandList::ResumeRecording()
+{
+	RMLUI_ASSERT(recorder && !recorder->list);
+	recorder->list = this;
+}
+
+void RenderCommandList::BeginBounds()
+{
+	RMLUI_ASSERT(track_bounds);
+	bounds_active = true;
+	bounds = Rectanglef::MakeInvalid();
+}
+
+Rectanglef RenderCommandList::EndBounds()
+{
+	bounds_active = false;
+	return bounds;
+}
+
+bool RenderCommandList::CanReplay(RenderInterface* in_render_interface) const
+{
+	return render_interface && render_interface == in_render_interface && recorded_release_count == release_count;
+}
+
+void RenderCommandList::ReleaseCompiledGeometry()
+{
+	for (Commands* list_commands : {&commands, &submitted_commands})
+	{
+		for (Batch& batch : list_commands->batches)
+		{
+			if (batch.compiled && render_interface)
+				render_interface->ReleaseCompiledGeometry(batch.compiled);
+			batch.compiled = 0;
+			batch.compile_attempted = false;
+		}
+	}
+}
+
+// Converts geometry to quads if it consists only of axis-aligned quads with a single colour, laid out as generated by
+// GeometryUtilities::GenerateQuad(). The quads are stored in a buffer which is reused by the next conversion.
+static const Quad* ConvertToQuads(const Vertex* vertices, int num_vertices, const int* indices, int num_indices)
+{
+	if (num_vertices % 4 != 0 || num_indices != num_vertices / 4 * 6)
+		return nullptr;
+
+	static Vector<Quad> quads;
+	quads.resize(num_vertices / 4);
+
+	for (int i = 0; i < (int)quads.size(); i++)
+	{
+		const int base = i * 4;
+		const int* quad_indices = indices + i * 6;
+		if (quad_indices[0] != base || quad_indices[1] != base + 3 || quad_indices[2] != base + 1 || quad_indices[3] != base + 1 ||
+			quad_indices[4] != base + 3 || quad_indices[5] != base + 2)
+			return nullptr;
+
+		const Vertex* v = vertices + base;
+		const Colourb colour = v[0].colour;
+		if (v[1].colour != colour || v[2].colour != colour || v[3].colour != colour)
+			return nullptr;
+
+		if (v[1].position != Vector2f(v[2].position.x, v[0].position.y) || v[3].position != Vector2f(v[0].position.x, v[2].position.y))
+			return nullptr;
+
+		if (v[1].tex_coord != Vector2f(v[2].tex_coord.x, v[0].tex_coord.y) || v[3].tex_coord != Vector2f(v[0].tex_coord.x, v[2].tex_coord.y))
+			return nullptr;
+
+		Quad& quad = quads[i];
+		quad.top_left = v[0].position;
+		quad.bottom_right = v[2].position;
+		quad.tex_coord_top_left = v[0].tex_coord;
+		quad.tex_coord_bottom_right = v[2].tex_coord;
+		quad.colour = colour;
+	}
+
+	return quads.data();
+}
+
+CompiledGeometryHandle RenderCommandList::CompileGeometry(RenderInterface* render_interface, const Vertex* vertices, int num_vertices,
+	const int* indices, int num_indices, TextureHandle texture)
+{
+	constexpr int max_index16_vertices = 65536;
+
+	if (render_interface->SupportsQuads())
+	{
+		if (const Quad* quads = ConvertToQuads(vertices, num_vertices, indices, num_indices))
+		{
+			if (CompiledGeometryHandle handle = render_interface->CompileQuads(const_cast<Quad*>(quads), num_vertices / 4, texture))
+				return handle;
+		}
+	}
+
+	if (num_vertices <= max_index16_vertices && render_interface->Supports16BitIndices())
+	{
+		// Narrowing the indices is done once per compile, and the buffer is kept around for the next compile.
+		static Vector<uint16_t> indices16;
+		indices16.resize(num_indices);
+		for (int i = 0; i < num_indices; i++)
+			indices16[i] = (uint16_t)indices[i];
+
+		return render_interface->CompileGeometryIndex16(const_cast<Vertex*>(vertices), num_vertices, indices16.data(), num_indices, texture);
+	}
+
+	return render_interface->CompileGeometry(const_cast<Vertex*>(vertices), num_vertices, const_cast<int*>(indices), num_indices, texture);
+}
+
+void RenderCommandList::RenderGeometry(RenderInterface* render_interface, const Vertex* vertices, int num_vertices, const int* indices,
+	int num_indices, TextureHandle texture, Vector2f translation)
+{
+	if (render_interface->SupportsQuads())
+	{
+		if (const Quad* quads = ConvertToQuads(vertices, num_vertices, indices, num_indices))
+		{
+			render_interface->RenderQuads(const_cast<Quad*>(quads), num_vertices / 4, texture, translation);
+			return;
+		}
+	}
+
+	render_interface->RenderGeometry(const_cast<Vertex*>(vertices), num_vertices, const_cast<int*>(indices), num_indices, texture, translation);
+}
+
+void RenderCommandList::ReleaseTexture(TextureHandle texture)
+{
+	release_count += 1;
+	if (RenderInterface* render_interface = GetActiveRenderInterface())
+		render_interface->ReleaseTexture(texture);
+}
+
+void RenderCommandList::ReleaseGeometry(CompiledGeometryHandle geometry)
+{
+	release_count += 1;
+	if (RenderInterface* render_interface = GetActiveRenderInterface())
+		render_interface->ReleaseCompiledGeometry(geometry);
+}
+
+RenderInterface* RenderCommandList::GetRecordingInterface()
+{
+	return recorder && recorder->list ? recorder : nullptr;
+}
+
+RenderInterface* RenderCommandList::GetActiveRenderInterface()
+{
+	if (RenderInterface* recording_interface = GetRecordingInterface())
+		return recording_interface;
+	return ::Rml::GetRenderInterface();
+}
+
+RenderCommandList* RenderCommandList::GetRecordingList()
+{
+	return recorder && recorder->list ? recorder->list : nullptr;
+}
+
+void RenderCommandList::ReleaseAllCompiledGeometry()
+{
+	for (RenderCommandList* command_list : command_lists)
+		command_list->ReleaseCompiledGeometry();
+}
+
+void RenderCommandList::Shutdown()
+{
+	RMLUI_ASSERT(!recorder || !recorder->list);
+	delete recorder;
+	recorder = nullptr;
+}
+
+void RenderCommandList::RecordGeometry(const Vertex* in_vertices, int num_vertices, const int* in_indices, int num_indices, TextureHandle texture,
+	Vector2f translation)
+{
+	if (num_vertices <= 0 || num_indices <= 0)
+		return;
+
+	Batch* batch = (commands.batches.empty() ? nullptr : &commands.batches.back());
+	if (!batch || batch->geometry || batch->texture != texture || batch->state != commands.final_state)
+	{
+		commands.batches.emplace_back();
+		batch = &commands.batches.back();
+		batch->state = commands.final_state;
+		batch->texture = texture;
+		batch->vertex_offset = (int)commands.vertices.size();
+		batch->index_offset = (int)commands.indices.size();
+	}
+
+	// Bake the translation into the vertices, and offset the indices to the start of the batch.
+	const int base_index = batch->num_vertices;
+	commands.vertices.reserve(commands.vertices.size() + num_vertices);
+	for (int i = 0; i < num_vertices; i++)
+	{
+		commands.vertices.push_back(in_vertices[i]);
+		commands.vertices.back().position += translation;
+	}
+
+	if (track_bounds)
+	{
+		Rectanglef local_bounds = Rectanglef::FromPosition(commands.vertices[commands.vertices.size() - num_vertices].position);
+		for (size_t i = commands.vertices.size() - num_vertices; i < commands.vertices.size(); i++)
+			local_bounds.Join(commands.vertices[i].position);
+
+		const Rectanglef screen_bounds = GetScreenBounds(local_bounds);
+		JoinBounds(batch->bounds, screen_bounds);
+		if (bounds_active)
+			JoinBounds(bounds, screen_bounds);
+	}
+
+	commands.indices.reserve(commands.indices.size() + num_indices);
+	for (int i = 0; i < num_indices; i++)
+		commands.indices.push_back(in_indices[i] + base_index);
+
+	batch->num_vertices += num_vertices;
+	batch->num_indices += num_indices;
+}
+
+void RenderCommandList::RecordCompiledGeometry(CompiledGeometryHandle geometry, Vector2f translation)
+{
+	commands.batches.emplace_back();
+	Batch& batch = commands.batches.back();
+	batch.state = commands.final_state;
+	batch.geometry = geometry;
+	batch.translation = translation;
+
+	// The extent of compiled geometry is unknown, thus it may cover anything within the scissor region.
+	if (bounds_active)
+		JoinBounds(bounds, GetScreenBounds(unbounded));
+}
+
+Rectanglef RenderCommandList::GetScreenBounds(Rectanglef local_bounds) const
+{
+	const RenderState& state = commands.final_state;
+	Rectanglef result = local_bounds;
+
+	if (state.transform >= 0 && local_bounds != unbounded)
+	{
+		const Matrix4f& transform = commands.transforms[state.transform];
+		const Vector2f corners[4] = {local_bounds.TopLeft(), {local_bounds.Right(), local_bounds.Top()}, {local_bounds.Left(), local_bounds.Bottom()},
+			local_bounds.BottomRight()};
+
+		result = Rectanglef::MakeInvalid();
+		for (Vector2f corner : corners)
+		{
+			const Vector4f projected = transform * Vector4f(corner.x, corner.y, 0, 1);
+
+			// Points behind the viewer can't be reliably bounded.
+			if (projected.w <= 0.f)
+			{
+				result = unbounded;
+				break;
+			}
+
+			const Vector3f point = projected.PerspectiveDivide();
+			if (result.Valid())
+				result.Join(Vector2f(point.x, point.y));
+			else
+				result = Rectanglef::FromPosition(Vector2f(point.x, point.y));
+		}
+	}
+
+	if (state.scissor_enabled == 1 && state.scissor_region_set)
+		result.Intersect(Rectanglef(state.scissor_region));
+
+	return result;
+}
+
+void RenderCommandList::Submit(const Vector<Rectanglei>* regions)
+{
+	RMLUI_ZoneScoped;
+	RMLUI_ASSERT(render_interface);
+
+	if (recorded)
+	{
+		ReuseCompiledBatches();
+
+		// Keep the commands around for comparison with the next recording, and for replaying them.
+		std::swap(commands, submitted_commands);
+		recorded = false;
+	}
+	else
+	{
+		// The submitted commands are replayed, compile the batches which were only submitted once so far.
+		for (Batch& batch : submitted_commands.batches)
+		{
+			if (!batch.geometry && !batch.compile_attempted)
+			{
+				batch.compile_attempted = true;
+				batch.compiled = CompileGeometry(render_interface, &submitted_commands.vertices[batch.vertex_offset], batch.num_vertices,
+					&submitted_commands.indices[batch.index_offset], batch.num_indices, batch.texture);
+			}
+		}
+	}
+
+	RenderState current_state;
+
+	if (!regions)
+	{
+		for (const Batch& batch : submitted_commands.batches)
+		{
+			ApplyState(batch.state, current_state);
+			SubmitBatch(batch);
+		}
+	}
+	else
+	{
+		// Render the batches once for each region, scissored to the region.
+		for (const Rectanglei& region : *regions)
+		{
+			for (const Batch& batch : submitted_commands.batches)
+			{
+				if (batch.bounds.Valid() && !batch.bounds.Intersects(Rectanglef(region)))
+					continue;
+
+				RenderState state = batch.state;
+				Rectanglei scissor_region = region;
+				if (state.scissor_enabled == 1 && state.scissor_region_set)
+				{
+					if (!scissor_region.Intersects(state.scissor_region))
+						continue;
+					scissor_region.Intersect(state.scissor_region);
+				}
+
+				state.scissor_enabled = 1;
+				state.scissor_region_set = true;
+				state.scissor_region = scissor_region;
+
+				ApplyState(state, current_state);
+				SubmitBatch(batch);
+			}
+		}
+	}
+
+	ApplyState(submitted_commands.final_state, current_state);
+
+	for (CompiledGeometryHandle geometry : pending_geometry_releases)
+		render_interface->ReleaseCompiledGeometry(geometry);
+	for (TextureHandle texture : pending_texture_releases)
+		render_interface->ReleaseTexture(texture);
+	pending_geometry_releases.clear();
+	pending_texture_releases.clear();
+}
+
+void RenderCommandList::ReuseCompiledBatches()
+{
+	batch_lookup.clear();
+	for (int i = 0; i < (int)submitted_commands.batches.size(); i++)
+	{
+		const Batch& batch = submitted_commands.batches[i];
+		if (!batch.geometry)
+			batch_lookup.emplace_back(batch.hash, i);
+	}
+	std::sort(batch_lookup.begin(), batch_lookup.end());
+
+	for (Batch& batch : commands.batches)
+	{
+		if (batch.geometry)
+			continue;
+
+		batch.hash = commands.HashBatchData(batch);
+
+		auto it = std::lower_bound(batch_lookup.begin(), batch_lookup.end(), std::make_pair(batch.hash, -1));
+		for (; it != batch_lookup.end() && it->first == batch.hash; ++it)
+		{
+			if (it->second < 0)
+				continue;
+
+			Batch& submitted_batch = submitted_commands.batches[it->second];
+			if (!commands.IsBatchDataEqual(batch, submitted_commands, submitted_batch))
+				continue;
+
+			it->second = -1;
+			batch.compiled = submitted_batch.compiled;
+			batch.compile_attempted = submitted_batch.compile_attempted;
+			submitted_batch.compiled = 0;
+
+			// The batch was submitted twice in a row, chances are it will be submitted again. Compile it so that the render interface can keep
+			// it around. Batches which keep changing are never compiled, as their geometry would only be used once.
+			if (!batch.compile_attempted)
+			{
+				batch.compile_attempted = true;
+				batch.compiled = CompileGeometry(render_interface, &commands.vertices[batch.vertex_offset], batch.num_vertices,
+					&commands.indices[batch.index_offset], batch.num_indices, batch.texture);
+			}
+			break;
+		}
+	}
+
+	for (Batch& submitted_batch : submitted_commands.batches)
+	{
+		if (submitted_batch.compiled)
+		{
+			render_interface->ReleaseCompiledGeometry(submitted_batch.compiled);
+			submitted_batch.compiled = 0;
+		}
+	}
+}
+
+void RenderCommandList::SubmitBatch(const Batch& batch)
+{
+	if (batch.geometry)
+		render_interface->RenderCompiledGeometry(batch.geometry, batch.translation);
+	else if (batch.compiled)
+		render_interface->RenderCompiledGeometry(batch.compiled, Vector2f(0.f));
+	else
+		RenderGeometry(render_interface, &submitted_commands.vertices[batch.vertex_offset], batch.num_vertices,
+			&submitted_commands.indices[batch.index_offset], batch.num_indices, batch.texture, Vector2f(0.f));
+}
+
+void RenderCommandList::ApplyState(const RenderState& state, RenderState& current_state)
+{
+	if (state.scissor_enabled >= 0 && state.scissor_enabled != current_state.scissor_enabled)
+	{
+		render_interface->EnableScissorRegion(state.scissor_enabled == 1);
+		current_state.scissor_enabled = state.scissor_enabled;
+	}
+
+	if (state.scissor_region_set && (!current_state.scissor_region_set || state.scissor_region != current_state.scissor_region))
+	{
+		const Rectanglei& region = state.scissor_region;
+		render_interface->SetScissorRegion(region.Left(), region.Top(), region.Width(), region.Height());
+		current_state.scissor_region_set = true;
+		current_state.scissor_region = region;
+	}
+
+	if (state.transform != -2 && state.transform != current_state.transform)
+	{
+		render_interface->SetTransform(state.transform >= 0 ? &submitted_commands.transforms[state.transform] : nullptr);
+		current_state.transform = state.transform;
+	}
+}
+
+bool RenderCommandList::RenderState::operator==(const RenderState& other) const
+{
+	return scissor_enabled == other.scissor_enabled && scissor_region_set == other.scissor_region_set &&
+		(!scissor_region_set || scissor_region == other.scissor_region) && transform == other.transform;
+}
+
+void RenderCommandList::Commands::Clear()
+{
+	batches.clear();
+	vertices.clear();
+	indices.clear();
+	transforms.clear();
+	final_state = RenderState();
+}
+
+// Hashes plain data in 32-bit words using FNV-1a.
+static uint64_t HashWords(uint64_t hash, const void* data, size_t size)
+{
+	static_assert(sizeof(Vertex) % sizeof(uint32_t) == 0 && sizeof(int) == sizeof(uint32_t), "Expected vertices and indices made of 32-bit words.");
+	const uint32_t* words = static_cast<const uint32_t*>(data);
+	for (size_t i = 0; i < size / sizeof(uint32_t); i++)
+		hash = (hash ^ words[i]) * 0x100000001b3ull;
+	return hash;
+}
+
+uint64_t RenderCommandList::Commands::HashBatchData(const Batch& batch) const
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	hash = HashWords(hash, &batch.texture, sizeof(batch.texture));
+	hash = HashWords(hash, &vertices[batch.vertex_offset], batch.num_vertices * sizeof(Vertex));
+	hash = HashWords(hash, &indices[batch.index_offset], batch.num_indices * sizeof(int));
+	return hash;
+}
+
+bool RenderCommandList::Commands::IsBatchDataEqual(const Batch& batch, const Commands& other, const Batch& other_batch) const
+{
+	// Vertices are tightly packed plain data, so they can be compared bytewise. The indices are relative to the start of each batch.
+	return batch.texture == other_batch.texture && batch.num_vertices == other_batch.num_vertices && batch.num_indices == other_batch.num_indices &&
+		memcmp(&vertices[batch.vertex_offset], &other.vertices[other_batch.vertex_offset], batch.num_vertices * sizeof(Vertex)) == 0 &&
+		memcmp(&indices[batch.index_offset], &other.indices[other_batch.index_offset], batch.num_indices * sizeof(int)) == 0;
+}
+
+} // namespace Rml
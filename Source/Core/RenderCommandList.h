@@ -0,0 +1,203 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RENDERCOMMANDLIST_H
+#define RMLUI_CORE_RENDERCOMMANDLIST_H
+
+#include "../../Include/RmlUi/Core/Matrix4.h"
+#include "../../Include/RmlUi/Core/Rectangle.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+
+class RenderInterface;
+class RenderCommandRecorder;
+
+/**
+    A retained list of render commands for a single context.
+
+    While recording, internal render calls are made on a recorder which appends them to the list, see GetActiveRenderInterface().
+    Redundant state changes are dropped, and adjacent geometry sharing the same texture, scissor region and transform is merged
+    into a single batch. The list is then submitted to the application's render interface. Batches are matched by their contents
+    against the previous submission, those submitted unchanged are compiled once and re-submitted as compiled geometry, regardless
+    of changes to other batches. When nothing has changed since the last recording, the submitted commands can be replayed as they are.
+ */
+
+class RenderCommandList : NonCopyMoveable {
+public:
+	RenderCommandList();
+	~RenderCommandList();
+
+	/// Routes all render calls through this list until EndRecording() is called.
+	/// @param[in] render_interface The render interface that commands will be submitted to.
+	/// @param[in] track_bounds True to track the screen-space bounds of the recorded geometry, required for BeginBounds() and for
+	/// submitting within regions.
+	void BeginRecording(RenderInterface* render_interface, bool track_bounds = false);
+	/// Stops recording, the commands can then be submitted.
+	void EndRecording();
+
+	/// Temporarily routes render calls directly to the render interface while recording, such as for rendering into render targets.
+	void PauseRecording();
+	/// Continues recording after PauseRecording().
+	void ResumeRecording();
+
+	/// Returns the render interface that commands are submitted to.
+	RenderInterface* GetRenderInterface() const { return render_interface; }
+
+	/// Starts accumulating the screen-space bounds of all geometry recorded until EndBounds() is called.
+	void BeginBounds();
+	/// Returns the bounds accumulated since BeginBounds(), or an invalid rectangle if no geometry was recorded.
+	Rectanglef EndBounds();
+
+	/// Returns true if the last recorded commands can be submitted again without recording them anew, that is they were recorded for the
+	/// given render interface and no resources have been released since they were recorded.
+	bool CanReplay(RenderInterface* render_interface) const;
+
+	/// Submits the recorded commands to the render interface, or the last submitted commands again if nothing was recorded since then.
+	/// @param[in] regions If set, rendering is restricted to these regions by scissoring, and batches outside of them are skipped.
+	/// The regions must not overlap.
+	void Submit(const Vector<Rectanglei>* regions = nullptr);
+
+	/// Releases any geometry compiled by the render interface for this list.
+	void ReleaseCompiledGeometry();
+
+	/// Compiles geometry on the render interface. Geometry made up of quads is compiled as quads when supported by the render interface,
+	/// otherwise 16-bit indices are used when supported by the render interface and the vertex count.
+	static CompiledGeometryHandle CompileGeometry(RenderInterface* render_interface, const Vertex* vertices, int num_vertices, const int* indices,
+		int num_indices, TextureHandle texture);
+	/// Renders geometry on the render interface, as quads if the geometry is made up of quads and they are supported by the render interface.
+	static void RenderGeometry(RenderInterface* render_interface, const Vertex* vertices, int num_vertices, const int* indices, int num_indices,
+		TextureHandle texture, Vector2f translation);
+
+	/// Releases a texture on the active render interface. Recorded commands may refer to the texture, thus they will not be replayed.
+	static void ReleaseTexture(TextureHandle texture);
+	/// Releases compiled geometry on the active render interface. Recorded commands may refer to the geometry, thus they will not be replayed.
+	static void ReleaseGeometry(CompiledGeometryHandle geometry);
+
+	/// Returns the recording render interface while a list is being recorded, otherwise nullptr.
+	static RenderInterface* GetRecordingInterface();
+	/// Returns the render interface to make render calls on, that is the recorder while a list is being recorded, otherwise the application's
+	/// render interface.
+	static RenderInterface* GetActiveRenderInterface();
+	/// Returns the list being recorded, otherwise nullptr.
+	static RenderCommandList* GetRecordingList();
+	/// Releases the compiled geometry of all command lists.
+	static void ReleaseAllCompiledGeometry();
+	/// Destroys the shared recorder.
+	static void Shutdown();
+
+private:
+	// Render state which applies to a batch. Each state is unset until it is changed during recording, in which case the
+	// render interface's current state is inherited.
+	struct RenderState {
+		int scissor_enabled = -1;
+		bool scissor_region_set = false;
+		Rectanglei scissor_region;
+		// Index into 'transforms', or -1 for the identity transform, or -2 if unset.
+		int transform = -2;
+
+		bool operator==(const RenderState& other) const;
+		bool operator!=(const RenderState& other) const { return !(*this == other); }
+	};
+
+	struct Batch {
+		RenderState state;
+		TextureHandle texture = 0;
+		// Either a range of our vertices and indices, or a geometry handle compiled by the application.
+		int vertex_offset = 0;
+		int num_vertices = 0;
+		int index_offset = 0;
+		int num_indices = 0;
+		CompiledGeometryHandle geometry = 0;
+		Vector2f translation;
+		// Screen-space bounds of the batch, only tracked when requested.
+		Rectanglef bounds = Rectanglef::MakeInvalid();
+
+		// Hash of the texture, vertices, and indices of the batch, set on submit.
+		uint64_t hash = 0;
+		// Geometry compiled from the vertices and indices, once the batch has been submitted unchanged twice in a row.
+		CompiledGeometryHandle compiled = 0;
+		bool compile_attempted = false;
+	};
+
+	struct Commands {
+		Vector<Batch> batches;
+		Vector<Vertex> vertices;
+		Vector<int> indices;
+		Vector<Matrix4f> transforms;
+		// The state in effect at the end of the recording, applied after the last batch.
+		RenderState final_state;
+
+		void Clear();
+		uint64_t HashBatchData(const Batch& batch) const;
+		bool IsBatchDataEqual(const Batch& batch, const Commands& other, const Batch& other_batch) const;
+	};
+
+	void RecordGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture,
+		Vector2f translation);
+	void RecordCompiledGeometry(CompiledGeometryHandle geometry, Vector2f translation);
+
+	// Returns the screen-space bounds of geometry with the given local bounds, using the current recording state.
+	Rectanglef GetScreenBounds(Rectanglef local_bounds) const;
+
+	// Passes on compiled geometry from the submitted commands to the same batches of the recorded commands, or compiles them if they were
+	// submitted uncompiled. Releases the compiled geometry of batches which are not recorded again.
+	void ReuseCompiledBatches();
+
+	void SubmitBatch(const Batch& batch);
+	void ApplyState(const RenderState& state, RenderState& current_state);
+
+	RenderInterface* render_interface = nullptr;
+
+	bool track_bounds = false;
+	bool bounds_active = false;
+	Rectanglef bounds;
+
+	// The commands being recorded, and the commands of the last submission.
+	Commands commands;
+	Commands submitted_commands;
+
+	// True if commands were recorded since the last submission.
+	bool recorded = false;
+	// The number of resources released before the commands were last recorded.
+	uint32_t recorded_release_count = 0;
+
+	// Hash and index of each batch of the submitted commands, sorted by hash. The index is cleared once the batch has been matched.
+	Vector<std::pair<uint64_t, int>> batch_lookup;
+
+	// Render interface calls deferred until the recorded commands have been submitted.
+	Vector<CompiledGeometryHandle> pending_geometry_releases;
+	Vector<TextureHandle> pending_texture_releases;
+
+	friend class Rml::RenderCommandRecorder;
+};
+
+} // namespace Rml
+#endif
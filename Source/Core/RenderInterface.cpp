@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -48,6 +49,42 @@ CompiledGeometryHandle RenderInterface::CompileGeometry(Vertex* /*vertices*/, in
 	return 0;
 }
 
+bool RenderInterface::Supports16BitIndices()
+{
+	return false;
+}
+
+CompiledGeometryHandle RenderInterface::CompileGeometryIndex16(Vertex* /*vertices*/, int /*num_vertices*/, uint16_t* /*indices*/,
+	int /*num_indices*/, TextureHandle /*texture*/)
+{
+	return 0;
+}
+
+bool RenderInterface::SupportsQuads()
+{
+	return false;
+}
+
+void RenderInterface::RenderQuads(Quad* quads, int num_quads, TextureHandle texture, const Vector2f& translation)
+{
+	Vector<Vertex> vertices(num_quads * 4);
+	Vector<int> indices(num_quads * 6);
+
+	for (int i = 0; i < num_quads; i++)
+	{
+		const Quad& quad = quads[i];
+		GeometryUtilities::GenerateQuad(&vertices[i * 4], &indices[i * 6], quad.top_left, quad.bottom_right - quad.top_left, quad.colour,
+			quad.tex_coord_top_left, quad.tex_coord_bottom_right, i * 4);
+	}
+
+	RenderGeometry(vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size(), texture, translation);
+}
+
+CompiledGeometryHandle RenderInterface::CompileQuads(Quad* /*quads*/, int /*num_quads*/, TextureHandle /*texture*/)
+{
+	return 0;
+}
+
 void RenderInterface::RenderCompiledGeometry(CompiledGeometryHandle /*geometry*/, const Vector2f& /*translation*/) {}
 
 void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*/) {}
@@ -62,8 +99,37 @@ bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const b
 	return false;
 }
 
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, const Rectanglei& /*region*/)
+{
+	return false;
+}
+
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/) {}
 
+bool RenderInterface::SupportsDistanceFieldTextures()
+{
+	return false;
+}
+
+TextureHandle RenderInterface::CreateDistanceFieldTexture(TextureHandle /*texture*/, float /*edge*/, float /*softness*/)
+{
+	return 0;
+}
+
 void RenderInterface::SetTransform(const Matrix4f* /*transform*/) {}
 
+bool RenderInterface::IsBatchingEnabled()
+{
+	return false;
+}
+
+TextureHandle RenderInterface::CreateRenderTarget(const Vector2i& /*dimensions*/)
+{
+	return 0;
+}
+
+void RenderInterface::PushRenderTarget(TextureHandle /*render_target*/, const Rectanglei& /*region*/) {}
+
+void RenderInterface::PopRenderTarget() {}
+
 } // namespace Rml
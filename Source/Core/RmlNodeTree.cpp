@@ -0,0 +1,282 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RmlNodeTree.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "XMLParseTools.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Scans the text for RML tags and data expressions, in the same way as the factory does when instancing text. Returns false on invalid syntax.
+static bool ScanText(const String& text, bool& out_has_rml, bool& out_has_data_expression)
+{
+	bool inside_brackets = false;
+	bool inside_string = false;
+	char previous = 0;
+	for (const char c : text)
+	{
+		if (XMLParseTools::ParseDataBrackets(inside_brackets, inside_string, c, previous))
+			return false;
+
+		if (inside_brackets)
+			out_has_data_expression = true;
+		else if (c == '<')
+			out_has_rml = true;
+
+		previous = c;
+	}
+	return true;
+}
+
+static bool IsTranslated(const String& text)
+{
+	SystemInterface* system_interface = GetSystemInterface();
+	if (!system_interface)
+		return false;
+
+	String translated;
+	system_interface->TranslateString(translated, text);
+	return translated != text;
+}
+
+/*
+    Builds the node tree from the XML parser, mirroring the behavior of the regular XML parser with the default node handler.
+*/
+class RmlNodeTreeParser final : public BaseXMLParser {
+public:
+	RmlNodeTreeParser(RmlNodeTree& tree) : tree(tree)
+	{
+		RegisterCDATATag("script");
+		RegisterCDATATag("style");
+
+		for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+			RegisterInnerXMLAttribute(name);
+	}
+
+	bool IsValid() const { return valid && root_closed && open_nodes.empty(); }
+
+	void HandleElementStart(const String& in_name, const XMLAttributes& attributes) override
+	{
+		const String name = StringUtilities::ToLower(in_name);
+
+		// Skip the body tag wrapping the contents.
+		if (!root_opened)
+		{
+			root_opened = true;
+			return;
+		}
+
+		// Tags with dedicated node handlers may construct their contents in their own way.
+		if (root_closed || XMLParser::GetNodeHandler(name))
+			valid = false;
+
+		open_nodes.push_back((int)tree.nodes.size());
+		tree.nodes.push_back(RmlNodeTree::Node{RmlNodeTree::NodeType::Element, name, attributes, String(), false, 0});
+	}
+
+	void HandleElementEnd(const String& in_name) override
+	{
+		if (open_nodes.empty())
+		{
+			root_closed = true;
+			return;
+		}
+
+		RmlNodeTree::Node& node = tree.nodes[open_nodes.back()];
+		if (node.value != StringUtilities::ToLower(in_name))
+			valid = false;
+
+		node.end = (int)tree.nodes.size();
+		open_nodes.pop_back();
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		if (type == XMLDataType::InnerXML)
+		{
+			if (open_nodes.empty())
+			{
+				valid = false;
+				return;
+			}
+
+			RmlNodeTree::Node& node = tree.nodes[open_nodes.back()];
+			node.text = data;
+			node.has_inner_rml = true;
+		}
+		else
+		{
+			tree.AddTextNode(data);
+		}
+	}
+
+private:
+	RmlNodeTree& tree;
+	Vector<int> open_nodes;
+	bool root_opened = false;
+	bool root_closed = false;
+	bool valid = true;
+};
+
+UniquePtr<RmlNodeTree> RmlNodeTree::Parse(const String& rml)
+{
+	RMLUI_ZoneScoped;
+
+	UniquePtr<RmlNodeTree> tree = MakeUnique<RmlNodeTree>();
+	tree->source = rml;
+
+	if (std::all_of(rml.begin(), rml.end(), &StringUtilities::IsWhitespace))
+		return tree;
+
+	bool has_rml = false;
+	bool has_data_expression = false;
+	if (!ScanText(rml, has_rml, has_data_expression))
+		return nullptr;
+
+	if (!has_rml)
+	{
+		tree->AddTextNode(rml);
+		return tree;
+	}
+
+	// Wrap the contents in a body tag, just like the factory does before handing them to the XML parser.
+	const String open_tag = "<body>";
+	const String close_tag = "</body>";
+	StreamMemory stream(rml.size() + open_tag.size() + close_tag.size());
+	stream.Write(open_tag);
+	stream.Write(rml);
+	stream.Write(close_tag);
+	stream.Seek(0, SEEK_SET);
+
+	RmlNodeTreeParser parser(*tree);
+	parser.Parse(&stream);
+
+	if (!parser.IsValid())
+		return nullptr;
+
+	return tree;
+}
+
+bool RmlNodeTree::Instance(Element* parent) const
+{
+	RMLUI_ZoneScopedC(0x6495ED);
+	RMLUI_ASSERT(parent);
+
+	// Translation applies to the raw contents, possibly changing how they are parsed.
+	if (IsTranslated(source))
+		return false;
+
+	// The contents are parsed as if placed inside a body tag, other base tags may use different node handlers.
+	Context* context = parent->GetContext();
+	if (context && context->GetDocumentsBaseTag() != "body")
+		return false;
+
+	InstanceNodes(parent, 0, (int)nodes.size());
+	return true;
+}
+
+void RmlNodeTree::InstanceNodes(Element* parent, int begin, int end) const
+{
+	for (int i = begin; i < end;)
+	{
+		const Node& node = nodes[i];
+		if (node.type != NodeType::Element)
+		{
+			InstanceText(parent, node);
+			i += 1;
+			continue;
+		}
+
+		// Children of elements that could not be instanced are added to the parent instead, in the same way as the XML parser.
+		Element* element = parent;
+		if (ElementPtr element_ptr = Factory::InstanceElement(parent, node.value, node.value, node.attributes))
+			element = parent->AppendChild(std::move(element_ptr));
+		else
+			Log::Message(Log::LT_ERROR, "Failed to create element for tag %s, instancer returned nullptr.", node.value.c_str());
+
+		InstanceNodes(element, i + 1, node.end);
+
+		if (node.has_inner_rml && !ElementUtilities::ApplyStructuralDataViews(element, node.text))
+			Factory::InstanceElementText(element, node.text);
+
+		i = node.end;
+	}
+}
+
+void RmlNodeTree::InstanceText(Element* parent, const Node& node) const
+{
+	if (node.type == NodeType::Text && !IsTranslated(node.value))
+	{
+		ElementPtr element = Factory::InstanceElement(parent, "#text", "#text", node.attributes);
+		if (ElementText* text_element = rmlui_dynamic_cast<ElementText*>(element.get()))
+		{
+			text_element->SetText(node.text);
+			parent->AppendChild(std::move(element));
+			return;
+		}
+	}
+
+	// Otherwise, let the factory instance the text from scratch.
+	Factory::InstanceElementText(parent, node.value);
+}
+
+void RmlNodeTree::AddTextNode(const String& data)
+{
+	if (std::all_of(data.begin(), data.end(), &StringUtilities::IsWhitespace))
+		return;
+
+	Node node = {NodeType::TextData, data, XMLAttributes(), String(), false, (int)nodes.size() + 1};
+
+	bool has_rml = false;
+	bool has_data_expression = false;
+	if (ScanText(data, has_rml, has_data_expression) && !has_rml)
+	{
+		node.type = NodeType::Text;
+		node.text = StringUtilities::DecodeRml(data);
+
+		// Tag the element so that the appropriate data view (DataViewText) is constructed.
+		if (has_data_expression)
+			node.attributes.emplace("data-text", Variant());
+	}
+
+	nodes.push_back(std::move(node));
+}
+
+} // namespace Rml
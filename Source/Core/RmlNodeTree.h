@@ -0,0 +1,85 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RMLNODETREE_H
+#define RMLUI_CORE_RMLNODETREE_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+    An immutable tree of RML nodes, parsed once so that the same RML contents can be instanced quickly many times over.
+
+    Instancing the tree is equivalent to calling 'SetInnerRML' with the parsed contents on an empty element, but without running the XML parser
+    again. Element attributes, inner RML of structural data views, and text nodes with their data expressions are all split up in advance.
+ */
+class RmlNodeTree : NonCopyMoveable {
+public:
+	/// Parses the given RML contents into a node tree.
+	/// @return The parsed tree, or nullptr if the contents can only be instanced by the regular XML parser, such as when using tags with
+	/// dedicated node handlers.
+	static UniquePtr<RmlNodeTree> Parse(const String& rml);
+
+	/// Instances the parsed contents as children of the given element.
+	/// @return False if the contents must instead be instanced through 'SetInnerRML', such as when they are subject to translation.
+	bool Instance(Element* parent) const;
+
+private:
+	enum class NodeType {
+		Element,  // An element with the given tag and attributes.
+		Text,     // A text node with decoded text, needs to be translated.
+		TextData, // Text data which must be passed through the factory, such as text containing RML from CDATA sections.
+	};
+
+	struct Node {
+		NodeType type;
+		String value;             // The element tag, or raw text data.
+		XMLAttributes attributes; // Attributes of the element or text node.
+		String text;              // The decoded text of text nodes, or the inner RML of elements with structural data views.
+		bool has_inner_rml;       // True if the element's contents are handed to its structural data views.
+		int end;                  // One past the index of the last descendant of this node.
+	};
+
+	void InstanceNodes(Element* parent, int begin, int end) const;
+	void InstanceText(Element* parent, const Node& node) const;
+
+	void AddTextNode(const String& data);
+
+	String source;
+	Vector<Node> nodes;
+
+	friend class RmlNodeTreeParser;
+};
+
+} // namespace Rml
+#endif
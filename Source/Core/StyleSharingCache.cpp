@@ -0,0 +1,227 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "StyleSharingCache.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "ElementStyle.h"
+
+namespace Rml {
+
+namespace {
+	// Only the most recently stored entries are kept, enough to cover e.g. alternating row styles.
+	constexpr size_t MaxEntries = 4;
+
+	struct DefinitionEntry {
+		const StyleSheet* style_sheet = nullptr;
+		Atom tag = Atom::None;
+		AtomList classes;
+		AtomList pseudo_classes;
+		uint64_t pseudo_class_mask = 0;
+		SharedPtr<const ElementDefinition> definition;
+	};
+
+	struct ComputedValuesEntry {
+		SharedPtr<const ElementDefinition> definition;
+		UniquePtr<Style::ComputedValues> values;
+	};
+
+	// Entries are kept between updates to avoid reallocations, only the first 'num_entries' of them are in use.
+	template <typename T>
+	struct EntryList {
+		Vector<T> entries;
+		size_t num_entries = 0;
+		size_t next_entry = 0;
+
+		T& Next()
+		{
+			if (entries.size() < MaxEntries)
+				entries.emplace_back();
+
+			T& entry = entries[next_entry];
+			next_entry = (next_entry + 1) % MaxEntries;
+			num_entries = Math::Min(num_entries + 1, MaxEntries);
+			return entry;
+		}
+		void Clear()
+		{
+			for (size_t i = 0; i < num_entries; i++)
+				entries[i].definition.reset();
+			num_entries = 0;
+			next_entry = 0;
+		}
+		typename Vector<T>::const_iterator begin() const { return entries.begin(); }
+		typename Vector<T>::const_iterator end() const { return entries.begin() + num_entries; }
+	};
+
+	struct CacheLevel {
+		const Element* element = nullptr;
+		EntryList<DefinitionEntry> definitions;
+		EntryList<ComputedValuesEntry> computed_values;
+	};
+
+	struct StyleSharingCacheData {
+		// Levels are reused between updates to avoid reallocating their entries.
+		Vector<CacheLevel> levels;
+		size_t num_levels = 0;
+	};
+
+	StyleSharingCacheData& GetData()
+	{
+		static StyleSharingCacheData data;
+		return data;
+	}
+
+	CacheLevel* GetLevelFor(const Element* element)
+	{
+		StyleSharingCacheData& data = GetData();
+		if (data.num_levels == 0)
+			return nullptr;
+
+		CacheLevel& level = data.levels[data.num_levels - 1];
+		if (level.element != element->GetParentNode())
+			return nullptr;
+
+		return &level;
+	}
+
+	bool MatchesPseudoClasses(const DefinitionEntry& entry, const ElementStyle* style)
+	{
+		if (entry.pseudo_class_mask != style->GetPseudoClassMask() || entry.pseudo_classes.size() != style->GetActivePseudoClasses().size())
+			return false;
+
+		for (Atom pseudo_class : entry.pseudo_classes)
+		{
+			if (!style->IsPseudoClassSet(pseudo_class))
+				return false;
+		}
+
+		return true;
+	}
+} // namespace
+
+void StyleSharingCache::PushParent(const Element* element)
+{
+	StyleSharingCacheData& data = GetData();
+	if (data.num_levels == data.levels.size())
+		data.levels.emplace_back();
+
+	CacheLevel& level = data.levels[data.num_levels];
+	data.num_levels += 1;
+
+	level.element = element;
+}
+
+void StyleSharingCache::PopParent()
+{
+	StyleSharingCacheData& data = GetData();
+	RMLUI_ASSERT(data.num_levels > 0);
+
+	data.num_levels -= 1;
+	CacheLevel& level = data.levels[data.num_levels];
+
+	// Release the definitions now, they should not be kept alive beyond the update.
+	level.element = nullptr;
+	level.definitions.Clear();
+	level.computed_values.Clear();
+}
+
+bool StyleSharingCache::FindDefinition(const Element* element, const StyleSheet* style_sheet, SharedPtr<const ElementDefinition>& out_definition)
+{
+	const CacheLevel* level = GetLevelFor(element);
+	if (!level)
+		return false;
+
+	const ElementStyle* style = element->GetStyle();
+	RMLUI_ASSERT(style->GetId() == Atom::None);
+
+	for (const DefinitionEntry& entry : level->definitions)
+	{
+		if (entry.style_sheet == style_sheet && entry.tag == style->GetTag() && entry.classes == style->GetClassList() &&
+			MatchesPseudoClasses(entry, style))
+		{
+			out_definition = entry.definition;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void StyleSharingCache::StoreDefinition(const Element* element, const StyleSheet* style_sheet, const SharedPtr<const ElementDefinition>& definition)
+{
+	CacheLevel* level = GetLevelFor(element);
+	if (!level)
+		return;
+
+	const ElementStyle* style = element->GetStyle();
+	RMLUI_ASSERT(style->GetId() == Atom::None);
+
+	DefinitionEntry& entry = level->definitions.Next();
+	entry.style_sheet = style_sheet;
+	entry.tag = style->GetTag();
+	entry.classes = style->GetClassList();
+	entry.pseudo_classes.clear();
+	for (const auto& pair : style->GetActivePseudoClasses())
+		entry.pseudo_classes.push_back(pair.first);
+	entry.pseudo_class_mask = style->GetPseudoClassMask();
+	entry.definition = definition;
+}
+
+const Style::ComputedValues* StyleSharingCache::FindComputedValues(const Element* element, const ElementDefinition* definition)
+{
+	const CacheLevel* level = GetLevelFor(element);
+	if (!level)
+		return nullptr;
+
+	for (const ComputedValuesEntry& entry : level->computed_values)
+	{
+		if (entry.definition.get() == definition)
+			return entry.values.get();
+	}
+
+	return nullptr;
+}
+
+void StyleSharingCache::StoreComputedValues(const Element* element, const SharedPtr<const ElementDefinition>& definition,
+	const Style::ComputedValues& values)
+{
+	CacheLevel* level = GetLevelFor(element);
+	if (!level)
+		return;
+
+	ComputedValuesEntry& entry = level->computed_values.Next();
+	if (!entry.values)
+		entry.values = MakeUnique<Style::ComputedValues>(nullptr);
+
+	entry.definition = definition;
+	entry.values->CopyNonInherited(values);
+	entry.values->CopyInherited(values);
+}
+
+} // namespace Rml
@@ -0,0 +1,69 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STYLESHARINGCACHE_H
+#define RMLUI_CORE_STYLESHARINGCACHE_H
+
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+class ElementDefinition;
+class StyleSheet;
+
+/**
+    A cache of recently resolved styles among the children of the element currently being updated.
+
+    Sibling elements with the same tag, classes and pseudo classes, and no id, share the same ancestors and thereby match the same style rules,
+    unless a rule depends on their attributes, their position, or their siblings. Such elements reuse the element definition of the first sibling.
+    Similarly, freshly created siblings without any inline properties and with the same definition copy the computed values of the first one.
+    The cache is scoped to the children update loop of each element, it is only used for elements whose parent is the most recently pushed one.
+ */
+namespace StyleSharingCache {
+	/// Opens a new, empty cache for the children of the given element, to be called before updating its children.
+	void PushParent(const Element* element);
+	/// Closes the most recently opened cache, to be called after updating the children.
+	void PopParent();
+
+	/// Looks for a definition shared by a sibling with the same matching names as the given element.
+	/// @return True if a definition was found, in which case it is written to 'out_definition' (which may be null).
+	bool FindDefinition(const Element* element, const StyleSheet* style_sheet, SharedPtr<const ElementDefinition>& out_definition);
+	/// Stores the definition of the given element for use by its siblings.
+	/// @note Only call this when no rule considered for the element depends on anything but its names and ancestors.
+	void StoreDefinition(const Element* element, const StyleSheet* style_sheet, const SharedPtr<const ElementDefinition>& definition);
+
+	/// Returns the computed values of a freshly created sibling with the given definition, or nullptr if none is available.
+	const Style::ComputedValues* FindComputedValues(const Element* element, const ElementDefinition* definition);
+	/// Stores the computed values of a freshly created element for use by its siblings.
+	void StoreComputedValues(const Element* element, const SharedPtr<const ElementDefinition>& definition, const Style::ComputedValues& values);
+} // namespace StyleSharingCache
+
+} // namespace Rml
+#endif
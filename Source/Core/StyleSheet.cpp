@@ -32,8 +32,11 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "AncestorFilter.h"
+#include "AtomTable.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "StyleSharingCache.h"
 #include "StyleSheetNode.h"
 #include <algorithm>
 
@@ -95,6 +98,35 @@ void StyleSheet::BuildNodeIndex()
 	RMLUI_ZoneScoped;
 	styled_node_index = {};
 	root->BuildIndex(styled_node_index);
+
+	invalidation_sets = {};
+	root->BuildInvalidationSets(invalidation_sets, StyleInvalidation::None);
+}
+
+StyleInvalidation StyleSheet::GetClassInvalidation(const String& class_name) const
+{
+	return GetClassInvalidation(AtomTable::Find(class_name));
+}
+
+StyleInvalidation StyleSheet::GetClassInvalidation(Atom class_name) const
+{
+	auto it = invalidation_sets.classes.find(class_name);
+	if (it != invalidation_sets.classes.end())
+		return it->second;
+	return StyleInvalidation::None;
+}
+
+StyleInvalidation StyleSheet::GetPseudoClassInvalidation(const String& pseudo_class) const
+{
+	return GetPseudoClassInvalidation(AtomTable::Find(pseudo_class));
+}
+
+StyleInvalidation StyleSheet::GetPseudoClassInvalidation(Atom pseudo_class) const
+{
+	auto it = invalidation_sets.pseudo_classes.find(pseudo_class);
+	if (it != invalidation_sets.pseudo_classes.end())
+		return it->second;
+	return StyleInvalidation::None;
 }
 
 const DecoratorSpecification* StyleSheet::GetDecoratorSpecification(const String& name) const
@@ -192,73 +224,88 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 {
 	RMLUI_ASSERT_NONRECURSIVE;
 
+	const ElementStyle* style = element->GetStyle();
+	const Atom tag = style->GetTag();
+	const Atom id = style->GetId();
+
+	// Text elements and the spacers of virtualized data views are never matched.
+	if (tag == AtomTable::TextTag || tag == AtomTable::SpacerTag)
+		return nullptr;
+
+	// Siblings without an id may share the definition of a previous sibling with the same names.
+	SharedPtr<const ElementDefinition> definition;
+	bool style_sharing_safe = (id == Atom::None);
+	if (style_sharing_safe && StyleSharingCache::FindDefinition(element, this, definition))
+		return definition;
+
 	// Using static to avoid allocations. Make sure we don't call this function recursively.
 	static Vector<const StyleSheetNode*> applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	// During the element update, the ancestor filter lets us reject most nodes requiring missing ancestors without walking up the element tree.
+	const bool use_ancestor_filter = AncestorFilter::IsValidFor(element);
+
+	auto AddApplicableNode = [element, use_ancestor_filter, &style_sharing_safe](const StyleSheetNode* node) {
+		// Any considered node that depends on more than the element's names and ancestors prevents sharing, even if it doesn't match.
+		style_sharing_safe &= node->IsStyleSharingSafe();
+
+		if ((!use_ancestor_filter || node->MayMatchAncestors()) && node->IsApplicable(element))
+			applicable_nodes.push_back(node);
+	};
+
+	auto AddApplicableNodes = [&AddApplicableNode](const StyleSheetIndex::NodeIndex& node_index, Atom key) {
+		auto it_nodes = node_index.find(static_cast<std::size_t>(key));
 		if (it_nodes != node_index.end())
 		{
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
 
+			// We found nodes that have at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
+			// nodes, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
+			// element's hierarchy to nodes in the style hierarchy.
 			for (const StyleSheetNode* node : nodes)
-			{
-				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
-				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
-				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
-					applicable_nodes.push_back(node);
-			}
+				AddApplicableNode(node);
 		}
 	};
 
-	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
-
-	// Text elements are never matched.
-	if (tag == "#text")
-		return nullptr;
-
 	// First, look up the indexed requirements.
-	if (!id.empty())
+	if (id != Atom::None)
 		AddApplicableNodes(styled_node_index.ids, id);
 
-	for (const String& name : class_names)
+	for (Atom name : style->GetClassList())
 		AddApplicableNodes(styled_node_index.classes, name);
 
 	AddApplicableNodes(styled_node_index.tags, tag);
 
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
-	{
-		if (node->IsApplicable(element))
-			applicable_nodes.push_back(node);
-	}
+		AddApplicableNode(node);
 
 	// If this element definition won't actually store any information, don't bother with it.
-	if (applicable_nodes.empty())
-		return nullptr;
-
-	// Sort the applicable nodes by specificity first, then by pointer value in case we have duplicate specificities.
-	std::sort(applicable_nodes.begin(), applicable_nodes.end(), [](const StyleSheetNode* a, const StyleSheetNode* b) {
-		const int a_specificity = a->GetSpecificity();
-		const int b_specificity = b->GetSpecificity();
-		if (a_specificity == b_specificity)
-			return a < b;
-		return a_specificity < b_specificity;
-	});
-
-	// Check if this puppy has already been cached in the node index.
-	SharedPtr<const ElementDefinition>& definition = node_cache[applicable_nodes];
-	if (!definition)
+	if (!applicable_nodes.empty())
 	{
-		// Otherwise, create a new definition and add it to our cache.
-		definition = MakeShared<const ElementDefinition>(applicable_nodes);
+		// Sort the applicable nodes by specificity first, then by pointer value in case we have duplicate specificities.
+		std::sort(applicable_nodes.begin(), applicable_nodes.end(), [](const StyleSheetNode* a, const StyleSheetNode* b) {
+			const int a_specificity = a->GetSpecificity();
+			const int b_specificity = b->GetSpecificity();
+			if (a_specificity == b_specificity)
+				return a < b;
+			return a_specificity < b_specificity;
+		});
+
+		// Check if this puppy has already been cached in the node index.
+		SharedPtr<const ElementDefinition>& cached_definition = node_cache[applicable_nodes];
+		if (!cached_definition)
+		{
+			// Otherwise, create a new definition and add it to our cache.
+			cached_definition = MakeShared<const ElementDefinition>(applicable_nodes);
+		}
+
+		definition = cached_definition;
 	}
 
+	if (style_sharing_safe)
+		StyleSharingCache::StoreDefinition(element, this, definition);
+
 	return definition;
 }
 
@@ -30,6 +30,8 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "AncestorFilter.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -37,9 +39,11 @@
 
 namespace Rml {
 
-static inline bool IsTextElement(const Element* element)
+// Text and spacer elements are never matched, and are skipped over when matching their siblings.
+static inline bool IsTrivialElement(const Element* element)
 {
-	return element->GetTagName() == "#text";
+	const Atom tag = element->GetStyle()->GetTag();
+	return tag == AtomTable::TextTag || tag == AtomTable::SpacerTag;
 }
 
 StyleSheetNode::StyleSheetNode()
@@ -50,11 +54,15 @@ StyleSheetNode::StyleSheetNode()
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAtomMasks();
+	CalculateAndSetAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAtomMasks();
+	CalculateAndSetAncestorHashes();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -129,8 +137,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (properties.GetNumProperties() > 0)
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, Atom key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[static_cast<std::size_t>(key)];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -138,7 +146,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 
 		// Add this node to the appropriate index for looking up applicable nodes later. Prioritize the most unique requirement first and the most
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
-		if (!selector.id.empty())
+		if (selector.id != Atom::None)
 		{
 			IndexInsertNode(styled_node_index.ids, selector.id, this);
 		}
@@ -148,7 +156,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
 			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
 		}
-		else if (!selector.tag.empty())
+		else if (selector.tag != Atom::None)
 		{
 			IndexInsertNode(styled_node_index.tags, selector.tag, this);
 		}
@@ -162,6 +170,51 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		child->BuildIndex(styled_node_index);
 }
 
+void StyleSheetNode::BuildInvalidationSets(StyleSheetInvalidationSets& invalidation_sets, StyleInvalidation forced_invalidation) const
+{
+	// Determine which elements can be affected when any of this node's names are toggled on an element matching this node. Only styled nodes
+	// affect the element itself, while child nodes determine whether descendants or siblings may be affected through combinators.
+	StyleInvalidation invalidation = forced_invalidation;
+	if (properties.GetNumProperties() > 0)
+		invalidation = invalidation | StyleInvalidation::Self;
+
+	for (const auto& child : children)
+	{
+		switch (child->selector.combinator)
+		{
+		case SelectorCombinator::Descendant:
+		case SelectorCombinator::Child: invalidation = invalidation | StyleInvalidation::Descendants; break;
+		case SelectorCombinator::NextSibling:
+		case SelectorCombinator::SubsequentSibling: invalidation = invalidation | StyleInvalidation::Siblings; break;
+		}
+	}
+
+	if (invalidation != StyleInvalidation::None)
+	{
+		for (Atom name : selector.class_names)
+		{
+			StyleInvalidation& entry = invalidation_sets.classes.emplace(name, StyleInvalidation::None).first->second;
+			entry = entry | invalidation;
+		}
+		for (Atom name : selector.pseudo_class_names)
+		{
+			StyleInvalidation& entry = invalidation_sets.pseudo_classes.emplace(name, StyleInvalidation::None).first->second;
+			entry = entry | invalidation;
+		}
+	}
+
+	// Selectors such as :not() contain their own selector trees which may be matched against the element, its ancestors or its siblings. We
+	// don't bother tracking their exact relationship, instead any names inside them invalidate all nearby elements.
+	for (const StructuralSelector& structural_selector : selector.structural_selectors)
+	{
+		if (structural_selector.selector_tree)
+			structural_selector.selector_tree->root->BuildInvalidationSets(invalidation_sets, StyleInvalidation::All);
+	}
+
+	for (const auto& child : children)
+		child->BuildInvalidationSets(invalidation_sets, forced_invalidation);
+}
+
 int StyleSheetNode::GetSpecificity() const
 {
 	return specificity;
@@ -179,30 +232,44 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 
 bool StyleSheetNode::Match(const Element* element) const
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	const ElementStyle* style = element->GetStyle();
+
+	if (selector.tag != Atom::None && selector.tag != style->GetTag())
 		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::None && selector.id != style->GetId())
 		return false;
 
-	for (auto& name : selector.class_names)
+	if (!MatchClassesAndPseudoClasses(style))
+		return false;
+
+	if (!selector.attributes.empty() && !MatchAttributes(element))
+		return false;
+
+	if (!selector.structural_selectors.empty() && !MatchStructuralSelector(element))
+		return false;
+
+	return true;
+}
+
+bool StyleSheetNode::MatchClassesAndPseudoClasses(const ElementStyle* style) const
+{
+	// First rule out any elements missing the bits of our classes or pseudo classes, most candidates are rejected here without any lookups.
+	if ((class_mask & ~style->GetClassMask()) || (pseudo_class_mask & ~style->GetPseudoClassMask()))
+		return false;
+
+	for (Atom name : selector.class_names)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	for (auto& name : selector.pseudo_class_names)
+	for (Atom name : selector.pseudo_class_names)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
-	if (!selector.attributes.empty() && !MatchAttributes(element))
-		return false;
-
-	if (!selector.structural_selectors.empty() && !MatchStructuralSelector(element))
-		return false;
-
 	return true;
 }
 
@@ -337,9 +404,9 @@ bool StyleSheetNode::TraverseMatch(const Element* element) const
 		{
 			element = parent_element->GetChild(i);
 
-			// First check if our sibling is a text element and if so skip it. For the descendant/child combinator above we can omit this step since
-			// text elements don't have children and thus any ancestor is not a text element.
-			if (IsTextElement(element))
+			// First check if our sibling is a text or spacer element and if so skip it. For the descendant/child combinator above we can omit this
+			// step since these elements don't have children and thus any ancestor is not a trivial element.
+			if (IsTrivialElement(element))
 				continue;
 			else if (parent->Match(element) && parent->TraverseMatch(element))
 				return true;
@@ -362,22 +429,15 @@ bool StyleSheetNode::IsApplicable(const Element* element) const
 
 	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
 	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
-	{
-		if (!element->IsPseudoClassSet(name))
-			return false;
-	}
+	const ElementStyle* style = element->GetStyle();
 
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (!MatchClassesAndPseudoClasses(style))
 		return false;
 
-	for (const String& name : selector.class_names)
-	{
-		if (!element->IsClassSet(name))
-			return false;
-	}
+	if (selector.tag != Atom::None && selector.tag != style->GetTag())
+		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::None && selector.id != style->GetId())
 		return false;
 
 	if (!selector.attributes.empty() && !MatchAttributes(element))
@@ -394,15 +454,27 @@ bool StyleSheetNode::IsApplicable(const Element* element) const
 	return true;
 }
 
+bool StyleSheetNode::MayMatchAncestors() const
+{
+	for (uint32_t hash : ancestor_hashes)
+	{
+		if (hash == 0)
+			break;
+		if (!AncestorFilter::MayContain(hash))
+			return false;
+	}
+	return true;
+}
+
 void StyleSheetNode::CalculateAndSetSpecificity()
 {
 	// First calculate the specificity of this node alone.
 	specificity = 0;
 
-	if (!selector.tag.empty())
+	if (selector.tag != Atom::None)
 		specificity += SelectorSpecificity::Tag;
 
-	if (!selector.id.empty())
+	if (selector.id != Atom::None)
 		specificity += SelectorSpecificity::ID;
 
 	specificity += SelectorSpecificity::Class * (int)selector.class_names.size();
@@ -417,4 +489,41 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAndSetAtomMasks()
+{
+	class_mask = 0;
+	for (Atom name : selector.class_names)
+		class_mask |= GetAtomMaskBit(name);
+
+	pseudo_class_mask = 0;
+	for (Atom name : selector.pseudo_class_names)
+		pseudo_class_mask |= GetAtomMaskBit(name);
+}
+
+void StyleSheetNode::CalculateAndSetAncestorHashes()
+{
+	ancestor_hashes = {};
+	size_t num_hashes = 0;
+	auto AddHash = [&](AncestorFilterKey key, Atom atom) {
+		if (num_hashes < MaxAncestorHashes)
+			ancestor_hashes[num_hashes++] = AncestorFilter::Hash(key, atom);
+	};
+
+	// A parent node reached through a descendant or child combinator is matched by an ancestor of the element, since siblings share their
+	// ancestors. Parent nodes reached through sibling combinators are matched by siblings, and can't be used for the filter.
+	for (const StyleSheetNode* node = this; node->parent && node->parent->parent && num_hashes < MaxAncestorHashes; node = node->parent)
+	{
+		if (node->selector.combinator != SelectorCombinator::Descendant && node->selector.combinator != SelectorCombinator::Child)
+			continue;
+
+		const CompoundSelector& ancestor_selector = node->parent->selector;
+		if (ancestor_selector.id != Atom::None)
+			AddHash(AncestorFilterKey::Id, ancestor_selector.id);
+		for (Atom name : ancestor_selector.class_names)
+			AddHash(AncestorFilterKey::Class, name);
+		if (ancestor_selector.tag != Atom::None)
+			AddHash(AncestorFilterKey::Tag, ancestor_selector.tag);
+	}
+}
+
 } // namespace Rml
@@ -35,7 +35,10 @@
 
 namespace Rml {
 
+class ElementStyle;
 struct StyleSheetIndex;
+struct StyleSheetInvalidationSets;
+enum class StyleInvalidation : uint8_t;
 class StyleSheetNode;
 using StyleSheetNodeList = Vector<UniquePtr<StyleSheetNode>>;
 
@@ -62,6 +65,9 @@ public:
 	UniquePtr<StyleSheetNode> DeepCopy(StyleSheetNode* parent = nullptr) const;
 	/// Builds up a style sheet's index recursively.
 	void BuildIndex(StyleSheetIndex& styled_node_index) const;
+	/// Records the classes and pseudo classes of this node and its descendants into the invalidation sets.
+	/// @param[in] forced_invalidation Invalidation added to every name, used for the conservative handling of nested selector trees.
+	void BuildInvalidationSets(StyleSheetInvalidationSets& invalidation_sets, StyleInvalidation forced_invalidation) const;
 
 	/// Imports properties from a single rule definition into the node's properties and sets the appropriate specificity on them. Any existing
 	/// attributes sharing a key with a new attribute will be overwritten if they are of a lower specificity.
@@ -75,15 +81,29 @@ public:
 	/// @note For performance reasons this call does not check whether 'element' is a text element. The caller must manually check this condition and
 	/// consider any text element not applicable.
 	bool IsApplicable(const Element* element) const;
+	/// Returns false if the ancestor filter shows that the element's ancestors are definitely missing names required by this node.
+	/// @note The caller must make sure the ancestor filter is valid for the element being matched.
+	bool MayMatchAncestors() const;
+	/// Returns true if matching this node only depends on the element's tag, id, classes, pseudo classes, and ancestors. Otherwise, the node may
+	/// match differently between siblings with identical names, and they can't share styles.
+	bool IsStyleSharingSafe() const
+	{
+		const bool sibling_combinator =
+			(selector.combinator == SelectorCombinator::NextSibling || selector.combinator == SelectorCombinator::SubsequentSibling);
+		return selector.attributes.empty() && selector.structural_selectors.empty() && !(sibling_combinator && parent && parent->parent);
+	}
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
 private:
 	void CalculateAndSetSpecificity();
+	void CalculateAndSetAtomMasks();
+	void CalculateAndSetAncestorHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
+	inline bool MatchClassesAndPseudoClasses(const ElementStyle* style) const;
 	inline bool MatchStructuralSelector(const Element* element) const;
 	inline bool MatchAttributes(const Element* element) const;
 
@@ -99,6 +119,14 @@ private:
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
+	// Masks of the classes and pseudo classes required by this node, used to quickly rule out elements that cannot match.
+	uint64_t class_mask = 0;
+	uint64_t pseudo_class_mask = 0;
+
+	// Ancestor filter hashes of the names that must be present on some ancestor element for this node to match, terminated by zero if not full.
+	static constexpr size_t MaxAncestorHashes = 4;
+	Array<uint32_t, MaxAncestorHashes> ancestor_hashes = {};
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
@@ -940,8 +940,8 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 
 				switch (rule[start_index])
 				{
-				case '#': selector.id = String(p_begin + 1, p_end); break;
-				case '.': selector.class_names.push_back(String(p_begin + 1, p_end)); break;
+				case '#': selector.id = AtomTable::GetOrCreate(String(p_begin + 1, p_end)); break;
+				case '.': selector.class_names.push_back(AtomTable::GetOrCreate(String(p_begin + 1, p_end))); break;
 				case ':':
 				{
 					String pseudo_class_name = String(p_begin + 1, p_end);
@@ -949,7 +949,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					if (node_selector.type != StructuralSelectorType::Invalid)
 						selector.structural_selectors.push_back(node_selector);
 					else
-						selector.pseudo_class_names.push_back(std::move(pseudo_class_name));
+						selector.pseudo_class_names.push_back(AtomTable::GetOrCreate(pseudo_class_name));
 				}
 				break;
 				case '[':
@@ -987,7 +987,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					selector.attributes.push_back(std::move(attribute));
 				}
 				break;
-				default: selector.tag = String(p_begin, p_end); break;
+				default: selector.tag = AtomTable::GetOrCreate(String(p_begin, p_end)); break;
 				}
 			}
 
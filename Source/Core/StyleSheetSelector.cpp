@@ -28,14 +28,18 @@
 
 #include "StyleSheetSelector.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "AtomTable.h"
+#include "ElementStyle.h"
 #include "StyleSheetNode.h"
 #include <tuple>
 
 namespace Rml {
 
-static inline bool IsTextElement(const Element* element)
+// Text elements, and the spacers of virtualized data views, don't count as siblings for structural selectors.
+static inline bool IsTrivialElement(const Element* element)
 {
-	return element->GetTagName() == "#text";
+	const Atom tag = element->GetStyle()->GetTag();
+	return tag == AtomTable::TextTag || tag == AtomTable::SpacerTag;
 }
 
 // Returns true if a positive integer can be found for n in the equation an + b = count.
@@ -108,8 +112,8 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 		{
 			Element* child = parent->GetChild(i);
 
-			// Skip text nodes.
-			if (IsTextElement(child))
+			// Skip text and spacer nodes.
+			if (IsTrivialElement(child))
 				continue;
 
 			// If we've found our element, then break; the current index is our element's index.
@@ -134,8 +138,8 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 		{
 			Element* child = parent->GetChild(i);
 
-			// Skip text nodes.
-			if (IsTextElement(child))
+			// Skip text and spacer nodes.
+			if (IsTrivialElement(child))
 				continue;
 
 			// If we've found our element, then break; the current index is our element's index.
@@ -215,11 +219,11 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 			if (child == element)
 				return true;
 
-			// If this child is not a text element, then the selector fails; this element is non-trivial.
-			if (!IsTextElement(child))
+			// If this child is not a trivial element, then the selector fails; this element is non-trivial.
+			if (!IsTrivialElement(child))
 				return false;
 
-			// Otherwise, skip over the text element to find the last non-trivial element.
+			// Otherwise, skip over the trivial element to find the last non-trivial element.
 			child_index++;
 		}
 
@@ -240,11 +244,11 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 			if (child == element)
 				return true;
 
-			// If this child is not a text element, then the selector fails; this element is non-trivial.
-			if (!IsTextElement(child))
+			// If this child is not a trivial element, then the selector fails; this element is non-trivial.
+			if (!IsTrivialElement(child))
 				return false;
 
-			// Otherwise, skip over the text element to find the last non-trivial element.
+			// Otherwise, skip over the trivial element to find the last non-trivial element.
 			child_index--;
 		}
 
@@ -315,7 +319,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				continue;
 
 			// Skip the child if it is trivial.
-			if (IsTextElement(child))
+			if (IsTrivialElement(child))
 				continue;
 
 			return false;
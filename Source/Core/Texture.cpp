@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/Texture.h"
+#include "TextureAtlas.h"
 #include "TextureDatabase.h"
 #include "TextureResource.h"
 
@@ -68,6 +69,28 @@ Vector2i Texture::GetDimensions() const
 	return resource->GetDimensions();
 }
 
+Rectanglef Texture::GetTexCoordRegion() const
+{
+	if (!resource)
+		return Rectanglef::FromSize(Vector2f(1.f));
+
+	return resource->GetTexCoordRegion();
+}
+
+bool Texture::IsInAtlas() const
+{
+	if (!resource)
+		return false;
+
+	return resource->IsInAtlas();
+}
+
+void Texture::AllowAtlas()
+{
+	if (resource && !resource->IsCallback() && TextureAtlas::IsEnabled())
+		resource = TextureDatabase::FetchAtlas(resource->GetSource());
+}
+
 bool Texture::operator==(const Texture& other) const
 {
 	return resource == other.resource;
@@ -0,0 +1,366 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureAtlas.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "RenderCommandList.h"
+#include <algorithm>
+
+namespace Rml {
+
+struct AtlasEntry {
+	String source;
+	Rectanglei rectangle;
+	// The loaded texture until it has been rendered into the page, after which the page holds the only copy and the texture is released.
+	TextureHandle texture;
+	// True while the texture of the source is loaded, otherwise its area is only kept for when it is loaded again.
+	bool loaded;
+};
+
+struct AtlasPage {
+	// The render target of the page, or zero while none of its textures are loaded.
+	TextureHandle render_target = 0;
+	Vector<AtlasEntry> entries;
+	// Areas of removed entries, including their gaps, which can be reused by other textures.
+	Vector<Rectanglei> free_areas;
+	// Top-left position of the next texture on the current shelf, and the height of the shelf.
+	Vector2i shelf_position = Vector2i(1, 1);
+	int shelf_height = 0;
+	// True when textures have been rendered into the render target, which must be kept when more textures are added.
+	bool rendered = false;
+	// True when textures were added since the page was last rendered.
+	bool dirty = false;
+};
+
+static int max_texture_size = 0;
+static int page_size = 0;
+static bool rendering = false;
+static Vector<AtlasPage> pages;
+
+// Places a texture in the smallest free area of the page which fits it, and keeps the remaining parts of the area free.
+static bool PlaceInFreeArea(AtlasPage& page, Vector2i dimensions, Vector2i& out_position)
+{
+	const Vector2i slot = dimensions + Vector2i(1);
+	auto it_best = page.free_areas.end();
+	for (auto it = page.free_areas.begin(); it != page.free_areas.end(); ++it)
+	{
+		if (it->Width() >= slot.x && it->Height() >= slot.y &&
+			(it_best == page.free_areas.end() || it->Width() * it->Height() < it_best->Width() * it_best->Height()))
+			it_best = it;
+	}
+
+	if (it_best == page.free_areas.end())
+		return false;
+
+	const Rectanglei area = *it_best;
+	page.free_areas.erase(it_best);
+
+	out_position = area.Position();
+	if (area.Width() > slot.x)
+		page.free_areas.push_back(Rectanglei::FromPositionSize(area.Position() + Vector2i(slot.x, 0), Vector2i(area.Width() - slot.x, slot.y)));
+	if (area.Height() > slot.y)
+		page.free_areas.push_back(Rectanglei::FromPositionSize(area.Position() + Vector2i(0, slot.y), Vector2i(area.Width(), area.Height() - slot.y)));
+	return true;
+}
+
+// Places a texture on the current shelf of the page, or on a new shelf below it. A gap of one pixel is kept around each texture so that
+// filtering does not bleed into its neighbors.
+static bool PlaceOnShelf(AtlasPage& page, Vector2i dimensions, Vector2i& out_position)
+{
+	if (page.shelf_position.x + dimensions.x + 1 > page_size)
+	{
+		page.shelf_position = Vector2i(1, page.shelf_position.y + page.shelf_height + 1);
+		page.shelf_height = 0;
+	}
+
+	if (page.shelf_position.x + dimensions.x + 1 > page_size || page.shelf_position.y + dimensions.y + 1 > page_size)
+		return false;
+
+	out_position = page.shelf_position;
+	page.shelf_position.x += dimensions.x + 1;
+	page.shelf_height = Math::Max(page.shelf_height, dimensions.y);
+	return true;
+}
+
+static void RenderQuad(RenderInterface* render_interface, Rectanglei rectangle, TextureHandle texture, Rectanglef tex_coord_region)
+{
+	Vertex vertices[4];
+	int indices[6];
+	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(rectangle.Position()), Vector2f(rectangle.Size()), Colourb(255),
+		tex_coord_region.TopLeft(), tex_coord_region.BottomRight());
+	render_interface->RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(0, 0));
+}
+
+// Pages are rendered directly on the application's render interface, instead of being recorded with the rendering of a context. The
+// textures are never part of any recorded rendering, and are released directly once rendered into the page.
+static void RenderPage(AtlasPage& page)
+{
+	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	if (!render_interface)
+		return;
+
+	const Rectanglei page_region = Rectanglei::FromSize(Vector2i(page_size));
+
+	// Render targets are cleared when pushed, so the previously rendered textures are first copied into a temporary render target.
+	TextureHandle page_copy = {};
+	if (page.rendered)
+	{
+		page_copy = render_interface->CreateRenderTarget(Vector2i(page_size));
+		if (page_copy)
+		{
+			render_interface->PushRenderTarget(page_copy, page_region);
+			render_interface->EnableScissorRegion(false);
+			render_interface->SetTransform(nullptr);
+			RenderQuad(render_interface, page_region, page.render_target, Rectanglef::FromSize(Vector2f(1.f)));
+			render_interface->PopRenderTarget();
+		}
+	}
+
+	render_interface->PushRenderTarget(page.render_target, page_region);
+	render_interface->EnableScissorRegion(false);
+	render_interface->SetTransform(nullptr);
+
+	for (AtlasEntry& entry : page.entries)
+	{
+		if (entry.texture)
+		{
+			RenderQuad(render_interface, entry.rectangle, entry.texture, Rectanglef::FromSize(Vector2f(1.f)));
+			render_interface->ReleaseTexture(entry.texture);
+			entry.texture = {};
+		}
+		else if (page_copy)
+		{
+			// Only the areas of the entries are copied back, so that removed entries leave cleared areas for other textures.
+			const Rectanglef tex_coord_region = Rectanglef::FromCorners(Vector2f(entry.rectangle.TopLeft()) / float(page_size),
+				Vector2f(entry.rectangle.BottomRight()) / float(page_size));
+			RenderQuad(render_interface, entry.rectangle, page_copy, tex_coord_region);
+		}
+	}
+
+	render_interface->PopRenderTarget();
+
+	if (page_copy)
+		render_interface->ReleaseTexture(page_copy);
+
+	page.rendered = true;
+	page.dirty = false;
+}
+
+// Marks the texture of the entry as released, and releases the render target of the page along with its last loaded texture.
+static void ReleaseEntry(AtlasPage& page, AtlasEntry& entry)
+{
+	entry.loaded = false;
+	if (entry.texture)
+	{
+		if (RenderInterface* render_interface = ::Rml::GetRenderInterface())
+			render_interface->ReleaseTexture(entry.texture);
+		entry.texture = {};
+	}
+
+	if (std::none_of(page.entries.begin(), page.entries.end(), [](const AtlasEntry& other) { return other.loaded; }))
+	{
+		RenderCommandList::ReleaseTexture(page.render_target);
+		page.render_target = {};
+		page.rendered = false;
+		page.dirty = false;
+	}
+}
+
+// Frees the area of the entry for other textures. The page is packed from the start again once all its entries are removed.
+static void RemoveEntry(AtlasPage& page, Vector<AtlasEntry>::iterator it_entry)
+{
+	if (it_entry->loaded)
+		ReleaseEntry(page, *it_entry);
+
+	page.free_areas.push_back(Rectanglei::FromPositionSize(it_entry->rectangle.Position(), it_entry->rectangle.Size() + Vector2i(1)));
+	page.entries.erase(it_entry);
+
+	if (page.entries.empty())
+	{
+		page.free_areas.clear();
+		page.shelf_position = Vector2i(1, 1);
+		page.shelf_height = 0;
+	}
+}
+
+static bool FindEntry(const String& source, AtlasPage*& out_page, Vector<AtlasEntry>::iterator& out_entry)
+{
+	for (AtlasPage& page : pages)
+	{
+		auto it_entry =
+			std::find_if(page.entries.begin(), page.entries.end(), [&source](const AtlasEntry& entry) { return entry.source == source; });
+		if (it_entry != page.entries.end())
+		{
+			out_page = &page;
+			out_entry = it_entry;
+			return true;
+		}
+	}
+	return false;
+}
+
+void TextureAtlas::Enable(int in_max_texture_size, int in_page_size)
+{
+	// Leave room for the gap around each texture.
+	max_texture_size = Math::Min(in_max_texture_size, in_page_size - 2);
+	page_size = in_page_size;
+}
+
+bool TextureAtlas::IsEnabled()
+{
+	return max_texture_size > 0;
+}
+
+bool TextureAtlas::Insert(const String& source, TextureHandle texture, Vector2i dimensions, TextureHandle& out_page,
+	Rectanglef& out_tex_coord_region)
+{
+	if (!IsEnabled() || dimensions.x <= 0 || dimensions.y <= 0 || dimensions.x > max_texture_size || dimensions.y > max_texture_size)
+		return false;
+
+	// Reuse the area of the texture if it was packed before, so that texture coordinates already generated for it remain valid. The area is
+	// freed if the dimensions of the texture changed since then.
+	AtlasPage* page = nullptr;
+	AtlasEntry* entry = nullptr;
+	Vector<AtlasEntry>::iterator it_entry;
+	if (FindEntry(source, page, it_entry))
+	{
+		RMLUI_ASSERT(!it_entry->loaded);
+		if (it_entry->rectangle.Size() == dimensions)
+		{
+			entry = &*it_entry;
+		}
+		else
+		{
+			RemoveEntry(*page, it_entry);
+			page = nullptr;
+		}
+	}
+
+	if (!entry)
+	{
+		Vector2i position;
+		auto it_page = std::find_if(pages.begin(), pages.end(),
+			[&](AtlasPage& other) { return PlaceInFreeArea(other, dimensions, position) || PlaceOnShelf(other, dimensions, position); });
+		if (it_page == pages.end())
+		{
+			pages.emplace_back();
+			it_page = pages.end() - 1;
+
+			const bool placed = PlaceOnShelf(*it_page, dimensions, position);
+			RMLUI_ASSERT(placed);
+			(void)placed;
+		}
+
+		page = &*it_page;
+		page->entries.push_back(AtlasEntry{source, Rectanglei::FromPositionSize(position, dimensions), TextureHandle{}, false});
+		entry = &page->entries.back();
+	}
+
+	if (!page->render_target)
+	{
+		RenderInterface* render_interface = ::Rml::GetRenderInterface();
+		page->render_target = (render_interface ? render_interface->CreateRenderTarget(Vector2i(page_size)) : 0);
+		if (!page->render_target)
+			return false;
+	}
+
+	entry->texture = texture;
+	entry->loaded = true;
+	page->dirty = true;
+
+	out_page = page->render_target;
+	out_tex_coord_region = Rectanglef::FromCorners(Vector2f(entry->rectangle.TopLeft()) / float(page_size),
+		Vector2f(entry->rectangle.BottomRight()) / float(page_size));
+
+	if (rendering)
+		RenderPage(*page);
+
+	return true;
+}
+
+void TextureAtlas::Release(const String& source)
+{
+	AtlasPage* page = nullptr;
+	Vector<AtlasEntry>::iterator it_entry;
+	if (FindEntry(source, page, it_entry) && it_entry->loaded)
+		ReleaseEntry(*page, *it_entry);
+}
+
+void TextureAtlas::Remove(const String& source)
+{
+	AtlasPage* page = nullptr;
+	Vector<AtlasEntry>::iterator it_entry;
+	if (FindEntry(source, page, it_entry))
+		RemoveEntry(*page, it_entry);
+}
+
+void TextureAtlas::BeginRender()
+{
+	for (AtlasPage& page : pages)
+	{
+		if (page.dirty)
+			RenderPage(page);
+	}
+	rendering = true;
+}
+
+void TextureAtlas::EndRender()
+{
+	rendering = false;
+}
+
+int TextureAtlas::GetNumPages()
+{
+	return (int)std::count_if(pages.begin(), pages.end(), [](const AtlasPage& page) { return page.render_target != 0; });
+}
+
+void TextureAtlas::Shutdown()
+{
+	if (RenderInterface* render_interface = ::Rml::GetRenderInterface())
+	{
+		for (AtlasPage& page : pages)
+		{
+			for (const AtlasEntry& entry : page.entries)
+			{
+				if (entry.texture)
+					render_interface->ReleaseTexture(entry.texture);
+			}
+			if (page.render_target)
+				render_interface->ReleaseTexture(page.render_target);
+		}
+	}
+
+	pages.clear();
+	max_texture_size = 0;
+	page_size = 0;
+	rendering = false;
+}
+
+} // namespace Rml
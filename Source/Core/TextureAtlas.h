@@ -0,0 +1,79 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTUREATLAS_H
+#define RMLUI_CORE_TEXTUREATLAS_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    Packs small textures loaded from file into shared atlas pages, allowing geometry using different images to be batched together.
+
+    Pages are render targets, and each packed texture is released as soon as it has been rendered into its page. Since render targets are
+    cleared when pushed, the contents of a page are copied through a temporary render target when more textures are added. Textures are
+    packed onto shelves, and each source keeps its area when its texture is released and loaded again, so that texture coordinates generated
+    for it remain valid. The area is freed for other textures when the source is removed.
+ */
+
+class TextureAtlas {
+public:
+	/// Enables packing of textures up to the given size into pages of the given size. A maximum size of zero disables packing.
+	static void Enable(int max_texture_size, int page_size);
+	/// Returns true if textures are packed into atlas pages.
+	static bool IsEnabled();
+
+	/// Attempts to pack a loaded texture into an atlas page, in which case the atlas takes ownership of the texture handle.
+	/// @param[in] source The source of the texture, used to place it where it was packed before.
+	/// @param[in] texture The handle of the loaded texture.
+	/// @param[in] dimensions The dimensions of the loaded texture.
+	/// @param[out] out_page The handle of the page containing the texture.
+	/// @param[out] out_tex_coord_region The region of the page covered by the texture, in normalized texture coordinates.
+	/// @return True if the texture was packed, false if it is too large or the render interface does not support render targets.
+	static bool Insert(const String& source, TextureHandle texture, Vector2i dimensions, TextureHandle& out_page,
+		Rectanglef& out_tex_coord_region);
+	/// Releases the packed texture of the given source, its area is kept for when the texture is loaded again. The render targets of pages
+	/// are released when they no longer contain any loaded textures.
+	static void Release(const String& source);
+	/// Removes the given source from its page, and frees its area for other textures.
+	static void Remove(const String& source);
+
+	/// Renders all pages with newly packed textures. Until EndRender() is called, pages are rendered as soon as textures are added.
+	static void BeginRender();
+	static void EndRender();
+
+	/// Returns the number of atlas pages with a render target.
+	static int GetNumPages();
+
+	/// Releases any remaining pages and disables packing.
+	static void Shutdown();
+};
+
+} // namespace Rml
+#endif
@@ -52,6 +52,8 @@ TextureDatabase::~TextureDatabase()
 
 	for (auto& texture : textures)
 		num_leaks_file += (texture.second.use_count() > 1);
+	for (auto& texture : atlas_textures)
+		num_leaks_file += (texture.second.use_count() > 1);
 
 	const int num_leaks_callback = (int)callback_textures.size();
 	const int total_num_leaks = num_leaks_file + num_leaks_callback;
@@ -95,6 +97,20 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 	return resource;
 }
 
+SharedPtr<TextureResource> TextureDatabase::FetchAtlas(const String& path)
+{
+	auto iterator = texture_database->atlas_textures.find(path);
+	if (iterator != texture_database->atlas_textures.end())
+		return iterator->second;
+
+	auto resource = MakeShared<TextureResource>();
+	resource->Set(path);
+	resource->AllowAtlas();
+
+	texture_database->atlas_textures[path] = resource;
+	return resource;
+}
+
 void TextureDatabase::AddCallbackTexture(TextureResource* texture)
 {
 	if (texture_database)
@@ -129,6 +145,17 @@ void TextureDatabase::ReleaseTextures()
 		for (const auto& texture : texture_database->textures)
 			texture.second->Release();
 
+		// Atlas textures no longer used anywhere else are dropped, which frees their areas in the atlas.
+		TextureMap& atlas_textures = texture_database->atlas_textures;
+		for (auto it = atlas_textures.begin(); it != atlas_textures.end();)
+		{
+			it->second->Release();
+			if (it->second.use_count() == 1)
+				it = atlas_textures.erase(it);
+			else
+				++it;
+		}
+
 		for (const auto& texture : texture_database->callback_textures)
 			texture->Release();
 	}
@@ -136,14 +163,21 @@ void TextureDatabase::ReleaseTextures()
 
 bool TextureDatabase::ReleaseTexture(const String& source)
 {
-	auto it = texture_database->textures.find(source);
-	if (it != texture_database->textures.end())
+	bool result = false;
+
+	for (TextureMap* map : {&texture_database->textures, &texture_database->atlas_textures})
 	{
-		it->second->Release();
-		return true;
+		auto it = map->find(source);
+		if (it != map->end())
+		{
+			it->second->Release();
+			if (map == &texture_database->atlas_textures && it->second.use_count() == 1)
+				map->erase(it);
+			result = true;
+		}
 	}
 
-	return false;
+	return result;
 }
 
 bool TextureDatabase::AllTexturesReleased()
@@ -154,6 +188,10 @@ bool TextureDatabase::AllTexturesReleased()
 			if (!texture.second->IsLoaded())
 				return false;
 
+		for (const auto& texture : texture_database->atlas_textures)
+			if (!texture.second->IsLoaded())
+				return false;
+
 		for (const auto& texture : texture_database->callback_textures)
 			if (!texture->IsLoaded())
 				return false;
@@ -49,6 +49,9 @@ public:
 	/// entry will be added and returned.
 	static SharedPtr<TextureResource> Fetch(const String& source, const String& source_directory);
 
+	/// Fetch a texture resource from file which may be packed into a texture atlas, using the path returned from a previous call to Fetch().
+	static SharedPtr<TextureResource> FetchAtlas(const String& path);
+
 	/// Release all textures in the database.
 	static void ReleaseTextures();
 
@@ -73,6 +76,7 @@ private:
 
 	using TextureMap = UnorderedMap<String, SharedPtr<TextureResource>>;
 	TextureMap textures;
+	TextureMap atlas_textures;
 
 	using CallbackTextureMap = UnorderedSet<TextureResource*>;
 	CallbackTextureMap callback_textures;
@@ -70,6 +70,14 @@ TextureLayoutTexture& TextureLayout::GetTexture(int index)
 	return textures[index];
 }
 
+const TextureLayoutTexture& TextureLayout::GetTexture(int index) const
+{
+	RMLUI_ASSERT(index >= 0);
+	RMLUI_ASSERT(index < GetNumTextures());
+
+	return textures[index];
+}
+
 int TextureLayout::GetNumTextures() const
 {
 	return (int)textures.size();
@@ -95,4 +103,47 @@ bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 	return true;
 }
 
+int TextureLayout::InsertRectangle(int id, Vector2i dimensions, int max_texture_dimensions)
+{
+	rectangles.push_back(TextureLayoutRectangle(id, dimensions));
+	const int rectangle_index = GetNumRectangles() - 1;
+
+	for (int i = 0; i < GetNumTextures(); ++i)
+	{
+		if (textures[i].Insert(*this, rectangle_index, i))
+			return rectangle_index;
+	}
+
+	// Make the new texture twice as large as the last one, so that the number of textures grows slowly as rectangles are added. Then grow
+	// it further as needed to fit the rectangle, including the one-pixel border.
+	Vector2i texture_dimensions = (textures.empty() ? Vector2i(32) : textures.back().GetDimensions());
+	bool grow = true;
+	while (grow || texture_dimensions.x < dimensions.x + 2 || texture_dimensions.y < dimensions.y + 2)
+	{
+		if (texture_dimensions.x >= max_texture_dimensions && texture_dimensions.y >= max_texture_dimensions)
+		{
+			if (grow)
+				break;
+			rectangles.pop_back();
+			return -1;
+		}
+
+		if (texture_dimensions.x < texture_dimensions.y)
+			texture_dimensions.x = Math::Min(texture_dimensions.x * 2, max_texture_dimensions);
+		else
+			texture_dimensions.y = Math::Min(texture_dimensions.y * 2, max_texture_dimensions);
+		grow = false;
+	}
+
+	TextureLayoutTexture texture(texture_dimensions);
+	if (!texture.Insert(*this, rectangle_index, GetNumTextures()))
+	{
+		rectangles.pop_back();
+		return -1;
+	}
+
+	textures.push_back(std::move(texture));
+	return rectangle_index;
+}
+
 } // namespace Rml
@@ -64,6 +64,7 @@ public:
 	/// @param[in] index The index of the desired texture.
 	/// @return The desired texture.
 	TextureLayoutTexture& GetTexture(int index);
+	const TextureLayoutTexture& GetTexture(int index) const;
 	/// Returns the number of textures in the layout.
 	/// @return The layout's texture count.
 	int GetNumTextures() const;
@@ -73,6 +74,14 @@ public:
 	/// @return True if the layout was generated successfully, false if not.
 	bool GenerateLayout(int max_texture_dimensions);
 
+	/// Adds a rectangle to a generated layout, placing it in the free space of the existing textures without moving any other
+	/// rectangles. If there is no room for it, a new texture is added with the same dimensions as the last one.
+	/// @param[in] id The id of the rectangle.
+	/// @param[in] dimensions The dimensions of the rectangle.
+	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
+	/// @return The index of the placed rectangle, or -1 if it could not be placed.
+	int InsertRectangle(int id, Vector2i dimensions, int max_texture_dimensions);
+
 private:
 	using RectangleList = Vector<TextureLayoutRectangle>;
 	using TextureList = Vector<TextureLayoutTexture>;
@@ -31,16 +31,14 @@
 
 namespace Rml {
 
-TextureLayoutRow::TextureLayoutRow()
-{
-	height = 0;
-}
+TextureLayoutRow::TextureLayoutRow(int y, int height) : y(y), width(1), height(height) {}
 
 TextureLayoutRow::~TextureLayoutRow() {}
 
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int _y)
 {
-	int width = 1;
+	y = _y;
+	width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
@@ -67,7 +65,7 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 		height = Math::Max(height, rectangle.GetDimensions().y);
 
 		// Add this glyph onto our list and mark it as placed.
-		rectangles.push_back(&rectangle);
+		rectangles.push_back(index);
 		rectangle.Place(layout.GetNumTextures(), Vector2i(width, y));
 		++placed_rectangles;
 
@@ -82,10 +80,25 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 	return placed_rectangles;
 }
 
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+bool TextureLayoutRow::Append(TextureLayout& layout, int rectangle_index, int texture_index, int max_width)
+{
+	TextureLayoutRectangle& rectangle = layout.GetRectangle(rectangle_index);
+	if (rectangle.GetDimensions().y > height || width + rectangle.GetDimensions().x + 1 > max_width)
+		return false;
+
+	rectangles.push_back(rectangle_index);
+	rectangle.Place(texture_index, Vector2i(width, y));
+
+	if (rectangle.GetDimensions().x > 0)
+		width += rectangle.GetDimensions().x + 1;
+
+	return true;
+}
+
+void TextureLayoutRow::Allocate(TextureLayout& layout, byte* texture_data, int stride)
 {
 	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+		layout.GetRectangle(rectangles[i]).Allocate(texture_data, stride);
 }
 
 int TextureLayoutRow::GetHeight() const
@@ -93,10 +106,15 @@ int TextureLayoutRow::GetHeight() const
 	return height;
 }
 
-void TextureLayoutRow::Unplace()
+int TextureLayoutRow::GetY() const
+{
+	return y;
+}
+
+void TextureLayoutRow::Unplace(TextureLayout& layout)
 {
 	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Unplace();
+		layout.GetRectangle(rectangles[i]).Unplace();
 }
 
 } // namespace Rml
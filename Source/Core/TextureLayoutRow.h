@@ -43,7 +43,7 @@ class TextureLayout;
 
 class TextureLayoutRow {
 public:
-	TextureLayoutRow();
+	TextureLayoutRow(int y = 0, int height = 0);
 	~TextureLayoutRow();
 
 	/// Attempts to position unplaced rectangles from the layout into this row.
@@ -53,21 +53,35 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int width, int y);
 
+	/// Attempts to place a rectangle from the layout at the end of this row, without changing the row's height.
+	/// @param[in] layout The layout containing the rectangle.
+	/// @param[in] rectangle_index The index of the rectangle within the layout.
+	/// @param[in] texture_index The index of the texture this row is placed on.
+	/// @param[in] max_width The maximum width of this row.
+	/// @return True if the rectangle was placed, false if there is no room for it.
+	bool Append(TextureLayout& layout, int rectangle_index, int texture_index, int max_width);
+
 	/// Assigns allocated texture data to all rectangles in this row.
+	/// @param[in] layout The layout containing the rectangles.
 	/// @param[in] texture_data The pointer to the beginning of the texture's data.
 	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	void Allocate(TextureLayout& layout, byte* texture_data, int stride);
 
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
+	/// Returns the y-coordinate of the row.
+	int GetY() const;
 
 	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	void Unplace(TextureLayout& layout);
 
 private:
-	using RectangleList = Vector<TextureLayoutRectangle*>;
+	// Indices of the rectangles within the layout, which remain valid as rectangles are added to the layout.
+	using RectangleList = Vector<int>;
 
+	int y;
+	int width;
 	int height;
 	RectangleList rectangles;
 };
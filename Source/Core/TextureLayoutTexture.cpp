@@ -32,7 +32,7 @@
 
 namespace Rml {
 
-TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0) {}
+TextureLayoutTexture::TextureLayoutTexture(Vector2i dimensions) : dimensions(dimensions) {}
 
 TextureLayoutTexture::~TextureLayoutTexture()
 {
@@ -97,7 +97,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 			if (height > dimensions.y)
 			{
 				// D'oh! We've exceeded our height boundaries. This row should be unplaced.
-				row.Unplace();
+				row.Unplace(layout);
 				success = false;
 				break;
 			}
@@ -125,14 +125,36 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		// Unplace all of the glyphs we tried to place and have an other crack.
 		for (size_t i = 0; i < rows.size(); i++)
-			rows[i].Unplace();
+			rows[i].Unplace(layout);
 
 		rows.clear();
 		num_placed_rectangles = 0;
 	}
 }
 
-UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
+bool TextureLayoutTexture::Insert(TextureLayout& layout, int rectangle_index, int texture_index)
+{
+	for (TextureLayoutRow& row : rows)
+	{
+		if (row.Append(layout, rectangle_index, texture_index, dimensions.x))
+			return true;
+	}
+
+	// Open a new row below the existing ones.
+	const Vector2i rectangle_dimensions = layout.GetRectangle(rectangle_index).GetDimensions();
+	const int y = (rows.empty() ? 1 : rows.back().GetY() + rows.back().GetHeight() + 1);
+	if (y + rectangle_dimensions.y + 1 > dimensions.y)
+		return false;
+
+	TextureLayoutRow row(y, rectangle_dimensions.y);
+	if (!row.Append(layout, rectangle_index, texture_index, dimensions.x))
+		return false;
+
+	rows.push_back(row);
+	return true;
+}
+
+UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture(TextureLayout& layout)
 {
 	// Note: this object does not free this texture data. It is freed in the font texture loader.
 	UniquePtr<byte[]> texture_data;
@@ -146,7 +168,7 @@ UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
 			((unsigned int*)(texture_data.get()))[i] = 0x00ffffff;
 
 		for (size_t i = 0; i < rows.size(); ++i)
-			rows[i].Allocate(texture_data.get(), dimensions.x * 4);
+			rows[i].Allocate(layout, texture_data.get(), dimensions.x * 4);
 	}
 
 	return texture_data;
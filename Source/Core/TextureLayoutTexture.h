@@ -46,7 +46,7 @@ class TextureResource;
 
 class TextureLayoutTexture {
 public:
-	TextureLayoutTexture();
+	TextureLayoutTexture(Vector2i dimensions = Vector2i(0, 0));
 	~TextureLayoutTexture();
 
 	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
@@ -61,9 +61,17 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int maximum_dimensions);
 
+	/// Attempts to place a rectangle from the layout into the free space of this texture, without moving any placed rectangles.
+	/// @param[in] layout The layout containing the rectangle.
+	/// @param[in] rectangle_index The index of the rectangle within the layout.
+	/// @param[in] texture_index The index of this texture within the layout.
+	/// @return True if the rectangle was placed, false if there is no room for it.
+	bool Insert(TextureLayout& layout, int rectangle_index, int texture_index);
+
 	/// Allocates the texture.
+	/// @param[in] layout The layout containing the rectangles of this texture.
 	/// @return The allocated texture data.
-	UniquePtr<byte[]> AllocateTexture();
+	UniquePtr<byte[]> AllocateTexture(TextureLayout& layout);
 
 private:
 	using RowList = Vector<TextureLayoutRow>;
@@ -31,6 +31,8 @@
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "RenderCommandList.h"
+#include "TextureAtlas.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -60,6 +62,10 @@ void TextureResource::Reset()
 {
 	Release();
 
+	// The source is dropped, so its area in the texture atlas can be reused by other textures.
+	if (allow_atlas)
+		TextureAtlas::Remove(source);
+
 	if (texture_callback)
 	{
 		TextureDatabase::RemoveCallbackTexture(this);
@@ -83,6 +89,30 @@ Vector2i TextureResource::GetDimensions()
 	return dimensions;
 }
 
+Rectanglef TextureResource::GetTexCoordRegion()
+{
+	if (!loaded)
+		Load();
+	return tex_coord_region;
+}
+
+bool TextureResource::IsInAtlas()
+{
+	if (!loaded)
+		Load();
+	return in_atlas;
+}
+
+void TextureResource::AllowAtlas()
+{
+	allow_atlas = true;
+}
+
+bool TextureResource::IsCallback() const
+{
+	return (bool)texture_callback;
+}
+
 const String& TextureResource::GetSource() const
 {
 	return source;
@@ -92,11 +122,18 @@ void TextureResource::Release()
 {
 	if (loaded)
 	{
-		RenderInterface* render_interface = ::Rml::GetRenderInterface();
-		RMLUI_ASSERT(render_interface);
-		render_interface->ReleaseTexture(handle);
+		if (in_atlas)
+		{
+			TextureAtlas::Release(source);
+		}
+		else
+		{
+			RenderCommandList::ReleaseTexture(handle);
+		}
 
 		handle = {};
+		in_atlas = false;
+		tex_coord_region = Rectanglef::FromSize(Vector2f(1.f));
 		dimensions = {};
 		loaded = false;
 	}
@@ -110,7 +147,7 @@ bool TextureResource::IsLoaded() const
 bool TextureResource::Load()
 {
 	RMLUI_ZoneScoped;
-	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	RenderInterface* render_interface = RenderCommandList::GetActiveRenderInterface();
 
 	loaded = true;
 
@@ -138,6 +175,13 @@ bool TextureResource::Load()
 		return false;
 	}
 
+	TextureHandle page = {};
+	if (allow_atlas && TextureAtlas::Insert(source, handle, dimensions, page, tex_coord_region))
+	{
+		in_atlas = true;
+		handle = page;
+	}
+
 	return true;
 }
 
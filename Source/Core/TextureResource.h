@@ -59,6 +59,17 @@ public:
 	/// Returns the dimensions of the resource's texture.
 	Vector2i GetDimensions();
 
+	/// Returns the region of the resource's texture covered by the resource, in normalized texture coordinates. This is the full texture unless
+	/// the resource is packed into a texture atlas.
+	Rectanglef GetTexCoordRegion();
+
+	/// Returns true if the resource is packed into a texture atlas, whose pages have premultiplied alpha.
+	bool IsInAtlas();
+	/// Allows the texture to be packed into a texture atlas when loaded.
+	void AllowAtlas();
+	/// Returns true if the texture is generated by a callback function.
+	bool IsCallback() const;
+
 	/// Returns the resource's source.
 	const String& GetSource() const;
 
@@ -80,6 +91,11 @@ private:
 	Vector2i dimensions;
 	bool loaded = false;
 
+	bool allow_atlas = false;
+	// True when the resource handle refers to an atlas page, and the loaded texture is owned by the texture atlas.
+	bool in_atlas = false;
+	Rectanglef tex_coord_region = Rectanglef::FromSize(Vector2f(1.f));
+
 	UniquePtr<TextureCallback> texture_callback;
 };
 
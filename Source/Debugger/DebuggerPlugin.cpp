@@ -127,6 +127,9 @@ bool DebuggerPlugin::SetContext(Context* context)
 		info_element->Reset();
 	}
 
+	// The debug geometry is rendered as part of the debugged context.
+	Geometry::SetContext(context);
+
 	debug_context = context;
 	return true;
 }
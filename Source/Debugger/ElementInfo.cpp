@@ -183,6 +183,10 @@ void ElementInfo::ProcessEvent(Event& event)
 	// Only process events if we're visible
 	if (IsVisible())
 	{
+		// The hover and source element outlines may change with any of the events below.
+		if (Context* context = GetContext())
+			context->DirtyRender();
+
 		if (event == EventId::Click)
 		{
 			Element* target_element = event.GetTargetElement();
@@ -46,8 +46,8 @@ void Geometry::SetContext(Context* _context)
 
 void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, const Colourb colour, float width)
 {
-	RenderInterface* render_interface = ::Rml::GetRenderInterface();
-	if (!context || !render_interface)
+	RenderInterface* render_interface = (context ? context->GetRenderInterface() : nullptr);
+	if (!render_interface)
 		return;
 
 	Vertex vertices[4 * 4];
@@ -63,8 +63,8 @@ void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, c
 
 void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const Colourb colour)
 {
-	RenderInterface* render_interface = ::Rml::GetRenderInterface();
-	if (!context || !render_interface)
+	RenderInterface* render_interface = (context ? context->GetRenderInterface() : nullptr);
+	if (!render_interface)
 		return;
 
 	Vertex vertices[4];
@@ -75,8 +75,10 @@ void ElementLottie::OnUpdate()
 	const double delay = std::modf((t - time_animation_start) / frame_duration, &_unused) * frame_duration;
 	if (IsVisible(true))
 	{
+		// The current frame of the animation is rendered from the elapsed time, thus the output changes on every update.
 		if (Context* ctx = GetContext())
 			ctx->RequestNextUpdate(delay);
+		DirtyRender();
 	}
 }
 
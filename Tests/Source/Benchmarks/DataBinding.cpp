@@ -31,6 +31,7 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <algorithm>
 #include <doctest.h>
 #include <nanobench.h>
 
@@ -83,6 +84,18 @@ static const String document_rml = R"(
 <p><span data-for="arrays.b">{{ it }} </span></p>
 <p><span data-for="arrays.c">{{ it.val }} </span></p>
 <p><span data-for="arrays.d">{{ 'a: ' + it.a + ', b: ' + it.b + ', c: ' + it.c.val + ' :: ' }}</span></p>
+
+<h1>List</h1>
+<div data-for="arrays.e"><span class="row">{{ it.val }}</span> <em>#{{ it_index }}</em></div>
+
+<h1>Virtual list</h1>
+<div id="virtual" style="height: 200px; overflow-y: auto;">
+	<div data-for="arrays.h" data-for-virtual="4"><span class="row">{{ it.val }}</span> <em>#{{ it_index }}</em></div>
+</div>
+
+<h1>Sorted lists</h1>
+<div data-for="arrays.f"><span class="row">{{ it.id }}</span> <em data-for="value : it.values">{{ value }}</em></div>
+<div data-for="arrays.g" data-for-key="it.id"><span class="row">{{ it.id }}</span> <em data-for="value : it.values">{{ value }}</em></div>
 </div>
 </body>
 </rml>
@@ -106,11 +119,20 @@ struct Basic {
 	StringWrap* c = new StringWrap("basic.c");
 };
 
+struct Row {
+	int id;
+	Vector<int> values;
+};
+
 struct Arrays {
 	Vector<int> a = {10, 11, 12};
 	Vector<int*> b = {new int(20), new int(21), new int(22)};
 	Vector<StringWrap> c = {StringWrap("c1"), StringWrap("c2"), StringWrap("c3")};
 	Vector<Basic> d = {Basic{10}, Basic{20}, Basic{30}};
+	Vector<StringWrap> e;
+	Vector<Row> f;
+	Vector<Row> g;
+	Vector<StringWrap> h;
 };
 
 static UniquePtr<Basic> basic;
@@ -144,12 +166,23 @@ static DataModelHandle InitializeDataBindings(Context* context)
 	constructor.RegisterArray<decltype(Arrays::c)>();
 	constructor.RegisterArray<decltype(Arrays::d)>();
 
+	if (auto handle = constructor.RegisterStruct<Row>())
+	{
+		handle.RegisterMember("id", &Row::id);
+		handle.RegisterMember("values", &Row::values);
+	}
+	constructor.RegisterArray<decltype(Arrays::f)>();
+
 	if (auto handle = constructor.RegisterStruct<Arrays>())
 	{
 		handle.RegisterMember("a", &Arrays::a);
 		handle.RegisterMember("b", &Arrays::b);
 		handle.RegisterMember("c", &Arrays::c);
 		handle.RegisterMember("d", &Arrays::d);
+		handle.RegisterMember("e", &Arrays::e);
+		handle.RegisterMember("f", &Arrays::f);
+		handle.RegisterMember("g", &Arrays::g);
+		handle.RegisterMember("h", &Arrays::h);
 	}
 	arrays = MakeUnique<Arrays>();
 	constructor.Bind("arrays", arrays.get());
@@ -186,6 +219,11 @@ TEST_CASE("data_binding")
 			model_handle.DirtyVariable("i0");
 			context->Update();
 		});
+		const DataVariableHandle i0_handle = model_handle.GetVariableHandle("i0");
+		bench.run("Dirty one variable (handle)", [&] {
+			model_handle.DirtyVariable(i0_handle);
+			context->Update();
+		});
 		bench.run("Dirty big variable", [&] {
 			model_handle.DirtyVariable("arrays");
 			context->Update();
@@ -239,6 +277,98 @@ TEST_CASE("data_binding")
 		});
 	}
 
+	SUBCASE("grow")
+	{
+		constexpr size_t num_rows = 1000;
+
+		nanobench::Bench bench;
+		bench.title("Data bindings: Grow list");
+		bench.relative(true);
+
+		bench.run("Grow and clear list", [&] {
+			arrays->e.resize(num_rows);
+			model_handle.DirtyVariable("arrays");
+			context->Update();
+
+			arrays->e.clear();
+			model_handle.DirtyVariable("arrays");
+			context->Update();
+		});
+
+		bench.run("Grow and clear list (virtual)", [&] {
+			arrays->h.resize(num_rows);
+			model_handle.DirtyVariable("arrays");
+			context->Update();
+
+			arrays->h.clear();
+			model_handle.DirtyVariable("arrays");
+			context->Update();
+		});
+	}
+
+	SUBCASE("scroll")
+	{
+		Element* element_virtual = document->GetElementById("virtual");
+
+		nanobench::Rng rng;
+		nanobench::Bench bench;
+		bench.title("Data bindings: Scroll virtual list");
+		bench.relative(true);
+
+		for (size_t num_rows : {1'000, 100'000})
+		{
+			arrays->h.resize(num_rows);
+			model_handle.DirtyVariable("arrays");
+			for (int i = 0; i < 3; i++)
+				context->Update();
+
+			bench.run("Scroll to random row of " + ToString(num_rows), [&] {
+				element_virtual->SetScrollTop(float(rng.bounded(uint32_t(element_virtual->GetScrollHeight()))));
+				context->Update();
+			});
+		}
+
+		arrays->h.clear();
+		model_handle.DirtyVariable("arrays");
+		context->Update();
+	}
+
+	SUBCASE("sort")
+	{
+		constexpr int num_rows = 1500;
+
+		nanobench::Bench bench;
+		bench.title("Data bindings: Sort list");
+		bench.relative(true);
+
+		auto BenchSort = [&](const String& name, Vector<Row>& list) {
+			list.resize(num_rows);
+			for (int i = 0; i < num_rows; i++)
+				list[i] = Row{i, Vector<int>(i % 5, i)};
+			model_handle.DirtyVariable("arrays");
+			context->Update();
+
+			bench.run("Reverse " + name, [&] {
+				std::reverse(list.begin(), list.end());
+				model_handle.DirtyVariable("arrays");
+				context->Update();
+			});
+			bench.run("Rotate " + name, [&] {
+				std::rotate(list.begin(), list.begin() + 1, list.end());
+				model_handle.DirtyVariable("arrays");
+				context->Update();
+			});
+
+			list.clear();
+			model_handle.DirtyVariable("arrays");
+			context->Update();
+		};
+
+		// Rows matched by index need to rebuild their nested lists, while rows matched by key are only moved.
+		BenchSort("(by index)", arrays->f);
+		BenchSort("(by key)", arrays->g);
+	}
+
 	TestsShell::RenderLoop();
 
 	document->Close();
@@ -315,3 +315,35 @@ TEST_CASE("element.asymptotic_complexity")
 
 	document->Close();
 }
+
+TEST_CASE("element.render_scrolled")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetProperty(PropertyId::OverflowY, Property(Style::Overflow::Auto));
+
+	nanobench::Bench bench;
+	bench.title("Render scrolled");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	// Only the rows visible in the scroll container should contribute to the render time.
+	for (const int num_rows : {10, 100, 1000})
+	{
+		el->SetInnerRML(GenerateRml(num_rows, DefaultRow));
+		el->SetScrollTop(0.5f * el->GetScrollHeight());
+		context->Update();
+		context->Render();
+
+		bench.complexityN(num_rows).run("Render " + ToString(num_rows) + " rows", [&] { context->Render(); });
+	}
+
+	document->Close();
+}
@@ -417,6 +417,16 @@ TEST_CASE("flexbox")
 			context->Render();
 		});
 
+		// Only the header changes, the flex container and its items should not need to be formatted again.
+		Element* header_title = document->QuerySelector("h1");
+		REQUIRE(header_title);
+		bool header_toggle = false;
+		bench.run("Update (header changed)", [&] {
+			header_toggle = !header_toggle;
+			header_title->SetInnerRML(header_toggle ? "Title" : "Header");
+			context->Update();
+		});
+
 		document->Close();
 		document_fast->Close();
 		document_float_reference->Close();
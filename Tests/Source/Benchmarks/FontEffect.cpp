@@ -85,3 +85,36 @@ TEST_CASE("font_effect")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("font_effect.radius")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	for (const char* effect_name : {"blur", "outline", "glow"})
+	{
+		nanobench::Bench bench;
+		bench.title(CreateString(64, "Font effect radius: %s", effect_name));
+		bench.relative(true);
+
+		for (int effect_size : {1, 2, 4, 8, 16})
+		{
+			const String rml_document =
+				CreateString(rml_font_effect_document.size() + 100, rml_font_effect_document.c_str(), effect_name, effect_size);
+
+			ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+			document->Show();
+			context->Update();
+			context->Render();
+
+			bench.run(CreateString(32, "%dpx", effect_size), [&]() {
+				Rml::ReleaseFontResources();
+				context->Render();
+			});
+
+			document->Close();
+		}
+	}
+
+	TestsShell::ShutdownShell();
+}
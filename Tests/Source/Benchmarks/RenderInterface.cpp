@@ -0,0 +1,84 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/GeometryUtilities.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+TEST_CASE("render_interface.immediate_geometry")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	REQUIRE(render_interface);
+
+	// Immediate geometry resembling a user interface: many small boxes, and some longer runs of text. Only meaningful with the shell backend,
+	// otherwise the dummy renderer just counts the render calls.
+	constexpr int num_boxes = 400;
+	constexpr int num_glyphs_per_run = 64;
+
+	auto GenerateQuads = [](Vector<Vertex>& vertices, Vector<int>& indices, int num_quads) {
+		vertices.resize(num_quads * 4);
+		indices.resize(num_quads * 6);
+		for (int i = 0; i < num_quads; i++)
+			GeometryUtilities::GenerateQuad(&vertices[i * 4], &indices[i * 6], Vector2f(i * 9.f, 0.f), Vector2f(8.f), Colourb(200, 100, 50), i * 4);
+	};
+
+	Vector<Vertex> box_vertices, run_vertices;
+	Vector<int> box_indices, run_indices;
+	GenerateQuads(box_vertices, box_indices, 1);
+	GenerateQuads(run_vertices, run_indices, num_glyphs_per_run);
+
+	nanobench::Bench bench;
+	bench.title("Immediate geometry");
+	bench.unit("draw");
+	bench.batch(num_boxes + num_boxes / 4);
+	bench.minEpochIterations(20);
+
+	bench.run("RenderGeometry", [&] {
+		TestsShell::BeginFrame();
+		for (int i = 0; i < num_boxes; i++)
+		{
+			const Vector2f translation(float(i % 40) * 25.f, float(i / 40) * 25.f);
+			render_interface->RenderGeometry(box_vertices.data(), (int)box_vertices.size(), box_indices.data(), (int)box_indices.size(), {},
+				translation);
+			if (i % 4 == 0)
+				render_interface->RenderGeometry(run_vertices.data(), (int)run_vertices.size(), run_indices.data(), (int)run_indices.size(), {},
+					translation + Vector2f(0.f, 10.f));
+		}
+		TestsShell::PresentFrame();
+	});
+}
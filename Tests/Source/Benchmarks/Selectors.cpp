@@ -26,11 +26,14 @@
  *
  */
 
+#include "../../../Source/Core/AtomTable.h"
+#include "../../../Source/Core/ElementStyle.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Types.h>
+#include <algorithm>
 #include <doctest.h>
 #include <nanobench.h>
 
@@ -66,6 +69,8 @@ static constexpr const char* document_rml_template = R"(
 			width: 800px;
 			height: 300px;
 		}
+		/* Makes the hover pseudo class affect all descendants, so that toggling it dirties their definitions. */
+		#performance:hover div {}
 
 /* Insert generated style rules below */
 %s
@@ -221,6 +226,7 @@ TEST_CASE("Selectors")
 	bench.title("Selector (rule name)");
 	bench.timeUnit(std::chrono::microseconds(1), "us");
 	bench.relative(true);
+	bench.minEpochIterations(10);
 
 	const Vector<String> complex_selectors = {
 		"*",
@@ -242,6 +248,9 @@ TEST_CASE("Selectors")
 		"[class^=col] div",
 		"[class$=col] div",
 		"[class*=col] div",
+		".row .col.col4",
+		".inrow:hover .col",
+		"div.col.col123.assign_text",
 	};
 
 	for (int i = 0; i < NUM_COMBINATIONS + (int)complex_selectors.size(); i++)
@@ -293,3 +302,115 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.match")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	const String rml = GenerateRml(num_rows);
+
+	const String compiled_document_rml = Rml::CreateString(1000, document_rml_template, "");
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+
+	ElementList elements;
+	el->QuerySelectorAll(elements, "*");
+	REQUIRE(!elements.empty());
+
+	// Compound selectors using the names of the document, see GenerateRml().
+	struct StringSelector {
+		String tag, id;
+		StringList class_names;
+	};
+	Vector<StringSelector> string_selectors;
+	for (int i = 0; i < num_rule_iterations; i++)
+	{
+		for (char c = 'a'; c <= 'z'; c++)
+		{
+			const String name = c + ToString(i);
+			string_selectors.push_back(StringSelector{"div", "", {"col", name}});
+			string_selectors.push_back(StringSelector{"div", "", {"inrow", name}});
+			string_selectors.push_back(StringSelector{"", name, {}});
+		}
+	}
+
+	struct AtomSelector {
+		Atom tag, id;
+		AtomList class_names;
+		uint64_t class_mask;
+	};
+	Vector<AtomSelector> atom_selectors;
+	for (const StringSelector& selector : string_selectors)
+	{
+		AtomSelector atom_selector = {AtomTable::GetOrCreate(selector.tag), AtomTable::GetOrCreate(selector.id), {}, 0};
+		for (const String& class_name : selector.class_names)
+		{
+			atom_selector.class_names.push_back(AtomTable::GetOrCreate(class_name));
+			atom_selector.class_mask |= GetAtomMaskBit(atom_selector.class_names.back());
+		}
+		atom_selectors.push_back(std::move(atom_selector));
+	}
+
+	// Benchmark the name requirements of selectors tested by StyleSheetNode::IsApplicable() against every element of the same document. Before
+	// names were interned, the tag, id, and classes of selectors and elements were compared as strings. Now they are compared as atoms, with
+	// the class mask ruling out most selectors up front.
+	nanobench::Bench bench;
+	bench.title("Selector match");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+	bench.minEpochIterations(10);
+
+	String msg = Rml::CreateString(128, "\nMatching %d compound selectors against %d elements.", (int)string_selectors.size(), (int)elements.size());
+	MESSAGE(msg);
+
+	int num_matches = 0;
+	bench.run("String compare (before)", [&] {
+		num_matches = 0;
+		for (const Element* element : elements)
+		{
+			for (const StringSelector& selector : string_selectors)
+			{
+				if (!selector.tag.empty() && selector.tag != element->GetTagName())
+					continue;
+				if (std::any_of(selector.class_names.begin(), selector.class_names.end(),
+						[element](const String& name) { return !element->IsClassSet(name); }))
+					continue;
+				if (!selector.id.empty() && selector.id != element->GetId())
+					continue;
+				num_matches += 1;
+			}
+		}
+	});
+	const int num_string_matches = num_matches;
+
+	bench.run("Atom compare (after)", [&] {
+		num_matches = 0;
+		for (Element* element : elements)
+		{
+			const ElementStyle* style = element->GetStyle();
+			for (const AtomSelector& selector : atom_selectors)
+			{
+				if (selector.tag != Atom::None && selector.tag != style->GetTag())
+					continue;
+				if ((selector.class_mask & ~style->GetClassMask()) ||
+					std::any_of(selector.class_names.begin(), selector.class_names.end(), [style](Atom name) { return !style->IsClassSet(name); }))
+					continue;
+				if (selector.id != Atom::None && selector.id != style->GetId())
+					continue;
+				num_matches += 1;
+			}
+		}
+	});
+	CHECK(num_matches == num_string_matches);
+	CHECK(num_matches > 0);
+
+	document->Close();
+	context->Update();
+}
@@ -272,6 +272,16 @@ TEST_CASE("table_basic")
 		context->Render();
 	});
 
+	// Only a single cell changes, the other cells should not need to be formatted again.
+	Element* cell = document->QuerySelector("tbody td");
+	REQUIRE(cell);
+	bool cell_toggle = false;
+	bench.run("Update (cell changed)", [&] {
+		cell_toggle = !cell_toggle;
+		cell->SetInnerRML(cell_toggle ? "DD" : "D");
+		context->Update();
+	});
+
 	document->Close();
 }
 
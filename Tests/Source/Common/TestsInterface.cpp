@@ -89,6 +89,61 @@ void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_v
 	counters.render_calls += 1;
 }
 
+Rml::CompiledGeometryHandle TestsRenderInterface::CompileGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/,
+	int /*num_indices*/, Rml::TextureHandle /*texture*/)
+{
+	if (!batching_enabled)
+		return 0;
+
+	counters.compile_geometry += 1;
+	return next_compiled_geometry++;
+}
+
+bool TestsRenderInterface::Supports16BitIndices()
+{
+	return index16_enabled;
+}
+
+Rml::CompiledGeometryHandle TestsRenderInterface::CompileGeometryIndex16(Rml::Vertex* /*vertices*/, int /*num_vertices*/, uint16_t* /*indices*/,
+	int /*num_indices*/, Rml::TextureHandle /*texture*/)
+{
+	if (!batching_enabled)
+		return 0;
+
+	counters.compile_geometry_index16 += 1;
+	return next_compiled_geometry++;
+}
+
+bool TestsRenderInterface::SupportsQuads()
+{
+	return quads_enabled;
+}
+
+void TestsRenderInterface::RenderQuads(Rml::Quad* /*quads*/, int /*num_quads*/, Rml::TextureHandle /*texture*/,
+	const Rml::Vector2f& /*translation*/)
+{
+	counters.render_quads += 1;
+}
+
+Rml::CompiledGeometryHandle TestsRenderInterface::CompileQuads(Rml::Quad* /*quads*/, int /*num_quads*/, Rml::TextureHandle /*texture*/)
+{
+	if (!batching_enabled)
+		return 0;
+
+	counters.compile_quads += 1;
+	return next_compiled_geometry++;
+}
+
+void TestsRenderInterface::RenderCompiledGeometry(Rml::CompiledGeometryHandle /*geometry*/, const Rml::Vector2f& /*translation*/)
+{
+	counters.render_compiled_geometry += 1;
+}
+
+void TestsRenderInterface::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle /*geometry*/)
+{
+	counters.release_compiled_geometry += 1;
+}
+
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
 {
 	counters.enable_scissor += 1;
@@ -102,7 +157,7 @@ void TestsRenderInterface::SetScissorRegion(int /*x*/, int /*y*/, int /*width*/,
 bool TestsRenderInterface::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& /*source*/)
 {
 	counters.load_texture += 1;
-	texture_handle = 1;
+	texture_handle = next_texture++;
 	texture_dimensions.x = 512;
 	texture_dimensions.y = 256;
 	return true;
@@ -112,7 +167,13 @@ bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, c
 	const Rml::Vector2i& /*source_dimensions*/)
 {
 	counters.generate_texture += 1;
-	texture_handle = 1;
+	texture_handle = next_texture++;
+	return true;
+}
+
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, const Rml::byte* /*source*/, const Rml::Rectanglei& /*region*/)
+{
+	counters.update_texture += 1;
 	return true;
 }
 
@@ -121,7 +182,42 @@ void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 	counters.release_texture += 1;
 }
 
+bool TestsRenderInterface::SupportsDistanceFieldTextures()
+{
+	return distance_fields_enabled;
+}
+
+Rml::TextureHandle TestsRenderInterface::CreateDistanceFieldTexture(Rml::TextureHandle /*texture_handle*/, float /*edge*/, float /*softness*/)
+{
+	counters.create_distance_field_texture += 1;
+	return next_texture++;
+}
+
 void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
 }
+
+bool TestsRenderInterface::IsBatchingEnabled()
+{
+	return batching_enabled;
+}
+
+Rml::TextureHandle TestsRenderInterface::CreateRenderTarget(const Rml::Vector2i& /*dimensions*/)
+{
+	if (!render_targets_enabled)
+		return 0;
+
+	counters.create_render_target += 1;
+	return next_texture++;
+}
+
+void TestsRenderInterface::PushRenderTarget(Rml::TextureHandle /*render_target*/, const Rml::Rectanglei& /*region*/)
+{
+	counters.push_render_target += 1;
+}
+
+void TestsRenderInterface::PopRenderTarget()
+{
+	counters.pop_render_target += 1;
+}
@@ -62,28 +62,80 @@ public:
 		size_t set_scissor;
 		size_t load_texture;
 		size_t generate_texture;
+		size_t update_texture;
 		size_t release_texture;
+		size_t create_distance_field_texture;
 		size_t set_transform;
+		size_t compile_geometry;
+		size_t compile_geometry_index16;
+		size_t render_quads;
+		size_t compile_quads;
+		size_t render_compiled_geometry;
+		size_t release_compiled_geometry;
+		size_t create_render_target;
+		size_t push_render_target;
+		size_t pop_render_target;
 	};
 
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
 		const Rml::Vector2f& translation) override;
 
+	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
+		Rml::TextureHandle texture) override;
+	bool Supports16BitIndices() override;
+	Rml::CompiledGeometryHandle CompileGeometryIndex16(Rml::Vertex* vertices, int num_vertices, uint16_t* indices, int num_indices,
+		Rml::TextureHandle texture) override;
+	bool SupportsQuads() override;
+	void RenderQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture, const Rml::Vector2f& translation) override;
+	Rml::CompiledGeometryHandle CompileQuads(Rml::Quad* quads, int num_quads, Rml::TextureHandle texture) override;
+	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
+	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Rectanglei& region) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
+	bool SupportsDistanceFieldTextures() override;
+	Rml::TextureHandle CreateDistanceFieldTexture(Rml::TextureHandle texture_handle, float edge, float softness) override;
+
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	bool IsBatchingEnabled() override;
+
+	Rml::TextureHandle CreateRenderTarget(const Rml::Vector2i& dimensions) override;
+	void PushRenderTarget(Rml::TextureHandle render_target, const Rml::Rectanglei& region) override;
+	void PopRenderTarget() override;
+
+	// Enables batching of render calls, geometry is only compiled while batching is enabled.
+	void SetBatchingEnabled(bool enabled) { batching_enabled = enabled; }
+	// Enables render targets for cached layers, they are not supported by default.
+	void SetRenderTargetsEnabled(bool enabled) { render_targets_enabled = enabled; }
+	// Enables compiling geometry with 16-bit indices, they are not supported by default.
+	void SetIndex16Enabled(bool enabled) { index16_enabled = enabled; }
+	// Enables rendering and compiling geometry as quads, they are not supported by default.
+	void SetQuadsEnabled(bool enabled) { quads_enabled = enabled; }
+	// Enables distance field textures, they are not supported by default.
+	void SetDistanceFieldsEnabled(bool enabled) { distance_fields_enabled = enabled; }
+	// Disables all of the above features.
+	void DisableFeatures() { batching_enabled = render_targets_enabled = index16_enabled = quads_enabled = distance_fields_enabled = false; }
+
 	const Counters& GetCounters() const { return counters; }
 
 	void ResetCounters() { counters = {}; }
 
 private:
 	Counters counters = {};
+	bool batching_enabled = false;
+	bool render_targets_enabled = false;
+	bool index16_enabled = false;
+	bool quads_enabled = false;
+	bool distance_fields_enabled = false;
+	Rml::CompiledGeometryHandle next_compiled_geometry = 1;
+	Rml::TextureHandle next_texture = 1;
 };
 
 #endif
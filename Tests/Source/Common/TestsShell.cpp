@@ -224,3 +224,22 @@ TestsSystemInterface* TestsShell::GetTestsSystemInterface()
 {
 	return &tests_system_interface;
 }
+
+TestsShell::DummyRenderer::DummyRenderer(Rml::Context* context, bool enable_batching) : context(context), render_interface(GetTestsRenderInterface())
+{
+	if (render_interface)
+		render_interface->SetBatchingEnabled(enable_batching);
+}
+
+TestsShell::DummyRenderer::~DummyRenderer()
+{
+	if (render_interface)
+		render_interface->DisableFeatures();
+}
+
+void TestsShell::DummyRenderer::RenderFrame()
+{
+	context->Update();
+	render_interface->ResetCounters();
+	context->Render();
+}
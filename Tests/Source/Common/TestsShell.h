@@ -64,6 +64,25 @@ Rml::String GetRenderStats();
 TestsRenderInterface* GetTestsRenderInterface();
 TestsSystemInterface* GetTestsSystemInterface();
 
+// Helper for tests inspecting the render calls made by a context, which only work with the dummy renderer. Any features enabled on the dummy
+// renderer are disabled again when the helper goes out of scope.
+class DummyRenderer {
+public:
+	DummyRenderer(Rml::Context* context, bool enable_batching = false);
+	~DummyRenderer();
+
+	// Returns false if the dummy renderer is not being used, in which case the test should be skipped.
+	explicit operator bool() const { return render_interface != nullptr; }
+	TestsRenderInterface* operator->() const { return render_interface; }
+
+	// Updates and renders the context. The counters of the dummy renderer are reset right before rendering, thus they only count this render.
+	void RenderFrame();
+
+private:
+	Rml::Context* context;
+	TestsRenderInterface* render_interface;
+};
+
 } // namespace TestsShell
 
 #endif
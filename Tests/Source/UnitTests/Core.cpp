@@ -32,6 +32,10 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/TaskInterface.h>
 #include <algorithm>
 #include <doctest.h>
 
@@ -165,11 +169,13 @@ TEST_CASE("core.release_textures")
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before);
 
-		// However, when we display a non-ASCII character not part of the initial cache, the font texture needs to be regenerated.
+		// Non-ASCII characters not part of the initial cache are added to the free space of the font texture, only uploading their region.
+		const auto counter_update_before = counters.update_texture;
 		element->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
 		TestsShell::RenderLoop();
-		CHECK(counters.generate_texture == counter_generate_before + 1);
-		CHECK(counters.release_texture == counter_release_before + 1);
+		CHECK(counters.update_texture == counter_update_before + 1);
+		CHECK(counters.generate_texture == counter_generate_before);
+		CHECK(counters.release_texture == counter_release_before);
 	}
 
 	document->Close();
@@ -179,3 +185,918 @@ TEST_CASE("core.release_textures")
 	// Finally, verify that all generated and loaded textures are released during shutdown.
 	CHECK(counters.generate_texture + counters.load_texture == counters.release_texture);
 }
+
+static const String document_font_glyph_cache_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 27px;
+		}
+	</style>
+</head>
+
+<body>Hello</body>
+</rml>
+)";
+
+TEST_CASE("core.font_glyph_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	REQUIRE(font_engine_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_glyph_cache_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const FontGlyphCacheStatistics statistics_unlimited = font_engine_interface->GetGlyphCacheStatistics();
+	CHECK(statistics_unlimited.num_glyphs > 0);
+	CHECK(statistics_unlimited.num_textures > 0);
+	CHECK(statistics_unlimited.texture_bytes > 0);
+
+	// When over budget, glyphs which are not part of the displayed text are evicted.
+	font_engine_interface->SetGlyphCacheBudget(1);
+	TestsShell::RenderLoop();
+	const FontGlyphCacheStatistics statistics_evicted = font_engine_interface->GetGlyphCacheStatistics();
+	CHECK(statistics_evicted.num_glyphs > 0);
+	CHECK(statistics_evicted.num_glyphs < statistics_unlimited.num_glyphs);
+	CHECK(statistics_evicted.texture_bytes < statistics_unlimited.texture_bytes);
+
+	// Glyphs in use are kept.
+	TestsShell::RenderLoop();
+	CHECK(font_engine_interface->GetGlyphCacheStatistics().num_glyphs == statistics_evicted.num_glyphs);
+
+	// Least recently used glyphs are evicted first. Use a new font size, and evict all glyphs not in use after showing 'a', 'b', and 'c' in
+	// turn. Then only 'a' and 'b' are not in use, and 'a' is evicted while 'b' which was used more recently is kept.
+	font_engine_interface->SetGlyphCacheBudget(0);
+	document->SetProperty("font-size", "31px");
+	for (const char* rml : {"Hello a", "Hello b", "Hello c"})
+	{
+		document->SetInnerRML(rml);
+		TestsShell::RenderLoop();
+	}
+	font_engine_interface->SetGlyphCacheBudget(1);
+	CHECK(font_engine_interface->TrimGlyphCache());
+	const FontGlyphCacheStatistics statistics_lru = font_engine_interface->GetGlyphCacheStatistics();
+
+	font_engine_interface->SetGlyphCacheBudget(statistics_lru.texture_bytes - 1);
+	CHECK(font_engine_interface->TrimGlyphCache());
+	CHECK(font_engine_interface->GetGlyphCacheStatistics().num_glyphs == statistics_lru.num_glyphs - 1);
+
+	// The cache is only trimmed again after glyphs have been used, so that multiple contexts trim it once per frame.
+	CHECK_FALSE(font_engine_interface->TrimGlyphCache());
+
+	font_engine_interface->SetGlyphCacheBudget(0);
+	document->SetInnerRML("Hello b");
+	TestsShell::RenderLoop();
+	CHECK(font_engine_interface->GetGlyphCacheStatistics().num_glyphs == statistics_lru.num_glyphs - 1);
+	document->SetInnerRML("Hello a");
+	TestsShell::RenderLoop();
+	CHECK(font_engine_interface->GetGlyphCacheStatistics().num_glyphs == statistics_lru.num_glyphs);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_font_distance_field_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-effect: outline(2px #f00);
+		}
+	</style>
+</head>
+
+<body>
+	<p style="font-size: 12px">Hello</p>
+	<p style="font-size: 17px">Hello</p>
+	<p style="font-size: 23px">Hello</p>
+	<p style="font-size: 40px">Hello</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.font_distance_field")
+{
+	TestsShell::ShutdownShell();
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	REQUIRE(render_interface);
+	render_interface->SetDistanceFieldsEnabled(true);
+	render_interface->ResetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	REQUIRE(font_engine_interface);
+	font_engine_interface->SetDistanceFieldFonts(true);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_distance_field_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// All sizes and the outline effect are rendered from the same texture.
+	CHECK(font_engine_interface->GetGlyphCacheStatistics().num_textures == 1);
+	CHECK(render_interface->GetCounters().generate_texture == 1);
+	CHECK(render_interface->GetCounters().create_distance_field_texture >= 2);
+
+	// Without distance fields, each size generates its own textures for the text and its effect.
+	font_engine_interface->SetDistanceFieldFonts(false);
+	ReleaseFontResources();
+	TestsShell::RenderLoop();
+	CHECK(font_engine_interface->GetGlyphCacheStatistics().num_textures >= 8);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+
+	const TestsRenderInterface::Counters& counters = render_interface->GetCounters();
+	CHECK(counters.generate_texture + counters.create_distance_field_texture == counters.release_texture);
+	render_interface->SetDistanceFieldsEnabled(false);
+}
+
+static const String document_font_tasks_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 29px;
+			font-effect: glow(2px #f00);
+		}
+	</style>
+</head>
+
+<body>Hello</body>
+</rml>
+)";
+
+TEST_CASE("core.font_tasks")
+{
+	// Runs the tasks in reverse order to make sure they do not depend on each other.
+	struct TestTaskInterface : TaskInterface {
+		void ParallelFor(int count, const Function<void(int)>& task) override
+		{
+			num_parallel_for += 1;
+			num_tasks += count;
+			for (int i = count - 1; i >= 0; i--)
+				task(i);
+		}
+		int num_parallel_for = 0;
+		int num_tasks = 0;
+	} task_interface;
+
+	TestsShell::ShutdownShell();
+	SetTaskInterface(&task_interface);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	CHECK(GetTaskInterface() == &task_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_tasks_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// The glyphs of both the base layer and the glow layer are generated through the task interface.
+	CHECK(task_interface.num_parallel_for >= 2);
+	CHECK(task_interface.num_tasks > task_interface.num_parallel_for);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+	CHECK(GetTaskInterface() == nullptr);
+}
+
+static const String document_batching_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			display: block;
+		}
+		div.box {
+			height: 10px;
+			background-color: #f00;
+		}
+		#clip {
+			height: 20px;
+			overflow: hidden;
+		}
+	</style>
+</head>
+
+<body>
+<div class="box"/>
+<div class="box"/>
+<div class="box"/>
+<div id="clip">
+	<div class="box"/>
+	<div class="box"/>
+	<div class="box"/>
+</div>
+<div class="box"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.render_batching")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context);
+	if (!renderer)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = renderer->GetCounters();
+
+	renderer.RenderFrame();
+	const auto unbatched = counters;
+	CHECK(unbatched.render_calls == 6);
+
+	renderer->SetBatchingEnabled(true);
+
+	// Adjacent boxes are merged, only the clipping region splits them into separate batches.
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == 3);
+	CHECK(counters.enable_scissor <= unbatched.enable_scissor);
+	CHECK(counters.set_scissor <= unbatched.set_scissor);
+	CHECK(counters.compile_geometry == 0);
+
+	// Unchanged frames compile their batches once, then keep re-submitting them.
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == 0);
+	CHECK(counters.compile_geometry == 3);
+	CHECK(counters.render_compiled_geometry == 3);
+
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == 0);
+	CHECK(counters.compile_geometry == 0);
+	CHECK(counters.render_compiled_geometry == 3);
+
+	// A change to the rendered geometry only invalidates the compiled geometry of the affected batch, it is compiled again once unchanged.
+	document->GetChild(0)->SetProperty("background-color", "#0f0");
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == 1);
+	CHECK(counters.release_compiled_geometry == 1);
+	CHECK(counters.render_compiled_geometry == 2);
+
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == 0);
+	CHECK(counters.compile_geometry == 1);
+	CHECK(counters.render_compiled_geometry == 3);
+
+	// Geometry is not compiled while being recorded, but still once it is rendered outside of the recording, such as into a layer.
+	Element* clip = document->GetElementById("clip");
+	for (int i = 0; i < clip->GetNumChildren(); i++)
+		clip->GetChild(i)->SetProperty("background-color", "#00f");
+	renderer.RenderFrame();
+	CHECK(counters.compile_geometry == 0);
+
+	renderer->SetRenderTargetsEnabled(true);
+	clip->SetProperty("layer", "cached");
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 1);
+	CHECK(counters.compile_geometry == 2);
+	CHECK(counters.render_compiled_geometry == 2);
+
+	clip->RemoveProperty("layer");
+	for (int i = 0; i < clip->GetNumChildren(); i++)
+		clip->GetChild(i)->RemoveProperty("background-color");
+	renderer->SetRenderTargetsEnabled(false);
+
+	renderer->SetBatchingEnabled(false);
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == unbatched.render_calls);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+class ElementRenderCounter : public Element {
+public:
+	ElementRenderCounter(const String& tag) : Element(tag) {}
+	int num_renders = 0;
+
+protected:
+	void OnRender() override { num_renders += 1; }
+};
+
+TEST_CASE("core.render_replay")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context, true);
+	if (!renderer)
+		return;
+
+	ElementInstancerGeneric<ElementRenderCounter> instancer;
+	Factory::RegisterElementInstancer("counter", &instancer);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+	ElementRenderCounter* counter = static_cast<ElementRenderCounter*>(document->AppendChild(document->CreateElement("counter")));
+	Element* image = document->AppendChild(document->CreateElement("img"));
+	image->SetAttribute("src", "/assets/high_scores_alien_1.tga");
+
+	const auto& counters = renderer->GetCounters();
+
+	renderer.RenderFrame();
+	CHECK(counter->num_renders == 1);
+
+	// Unchanged frames replay the recorded commands without rendering the elements again.
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counter->num_renders == 1);
+	CHECK(counters.render_compiled_geometry == 4);
+
+	counter->DirtyRender();
+	renderer.RenderFrame();
+	CHECK(counter->num_renders == 2);
+	CHECK(counters.render_compiled_geometry == 4);
+
+	// Released resources may be referred to by the recorded commands, thus they are recorded again.
+	Rml::ReleaseTextures();
+	renderer.RenderFrame();
+	CHECK(counter->num_renders == 3);
+
+	renderer->SetBatchingEnabled(false);
+	renderer.RenderFrame();
+	CHECK(counter->num_renders == 4);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.render_index16")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context);
+	if (!renderer)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = renderer->GetCounters();
+
+	renderer.RenderFrame();
+	renderer->SetBatchingEnabled(true);
+	renderer->SetIndex16Enabled(true);
+
+	// Batches are compiled on the second of two identical frames.
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counters.compile_geometry == 0);
+	CHECK(counters.compile_geometry_index16 == 3);
+	CHECK(counters.render_compiled_geometry == 3);
+
+	// Without support, geometry is compiled with the regular indices.
+	renderer->SetIndex16Enabled(false);
+	document->GetChild(0)->SetProperty("background-color", "#0f0");
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counters.compile_geometry == 1);
+	CHECK(counters.compile_geometry_index16 == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_quads_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			display: block;
+		}
+		#box {
+			height: 10px;
+			background-color: #f00;
+		}
+		#border {
+			height: 10px;
+			border: 1px #00f;
+		}
+	</style>
+</head>
+
+<body>
+<div id="box"/>
+<div id="text">Text</div>
+<div id="border"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.render_quads")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context);
+	if (!renderer)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_quads_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = renderer->GetCounters();
+
+	renderer.RenderFrame();
+	CHECK(counters.render_calls == 3);
+	CHECK(counters.render_quads == 0);
+
+	// Text is made up of quads, while backgrounds and borders are generated as general geometry.
+	renderer->SetQuadsEnabled(true);
+	renderer.RenderFrame();
+	CHECK(counters.render_quads == 1);
+	CHECK(counters.render_calls == 2);
+
+	// Batches of quads are compiled as quads, the background and border are merged into a single batch.
+	renderer->SetBatchingEnabled(true);
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counters.compile_quads == 1);
+	CHECK(counters.compile_geometry == 1);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_texture_atlas_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+	</style>
+</head>
+
+<body>
+<img src="/assets/high_scores_alien_1.tga"/>
+<img src="/assets/high_scores_alien_2.tga"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.texture_atlas")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context, true);
+	if (!renderer)
+		return;
+
+	const auto& counters = renderer->GetCounters();
+
+	renderer->SetRenderTargetsEnabled(true);
+
+	// Images using different textures cannot be batched together.
+	ElementDocument* document = context->LoadDocumentFromMemory(document_texture_atlas_rml);
+	REQUIRE(document);
+	document->Show();
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counters.create_render_target == 0);
+	CHECK(counters.render_compiled_geometry == 2);
+
+	document->Close();
+	context->Update();
+	Rml::ReleaseTextures();
+
+	// With the texture atlas enabled, both images are packed into a single page and rendered in one batch.
+	Rml::EnableTextureAtlas(512, 1024);
+	renderer->ResetCounters();
+	document = context->LoadDocumentFromMemory(document_texture_atlas_rml);
+	REQUIRE(document);
+	document->Show();
+	// The page is created when the images are loaded, and rendered before the context.
+	context->Update();
+	context->Render();
+	CHECK(counters.create_render_target == 1);
+	CHECK(counters.push_render_target == 1);
+	// The loaded textures are released once rendered into the page.
+	CHECK(counters.release_texture == 2);
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counters.create_render_target == 0);
+	CHECK(counters.push_render_target == 0);
+	CHECK(counters.render_compiled_geometry == 1);
+
+	document->Close();
+	context->Update();
+	Rml::ReleaseTextures();
+
+	// Textures keep their place in the atlas when released and loaded again in a different order, so that texture coordinates generated
+	// for them remain valid.
+	{
+		Texture texture_a, texture_b;
+		texture_a.Set("/assets/high_scores_alien_1.tga");
+		texture_a.AllowAtlas();
+		texture_b.Set("/assets/high_scores_alien_2.tga");
+		texture_b.AllowAtlas();
+
+		const Rectanglef region_a = texture_a.GetTexCoordRegion();
+		const Rectanglef region_b = texture_b.GetTexCoordRegion();
+		CHECK(texture_a.IsInAtlas());
+		CHECK(texture_b.IsInAtlas());
+		CHECK(region_a != region_b);
+
+		Rml::ReleaseTextures();
+		CHECK(texture_b.GetTexCoordRegion() == region_b);
+		CHECK(texture_a.GetTexCoordRegion() == region_a);
+		renderer.RenderFrame();
+		CHECK(counters.push_render_target == 1);
+
+		// Adding a texture to a rendered page copies its contents through a temporary render target.
+		Texture texture_c;
+		texture_c.Set("/assets/high_scores_alien_3.tga");
+		texture_c.AllowAtlas();
+		CHECK(texture_c.IsInAtlas());
+		renderer.RenderFrame();
+		CHECK(counters.create_render_target == 1);
+		CHECK(counters.push_render_target == 2);
+		CHECK(counters.release_texture == 2);
+	}
+	Rml::ReleaseTextures();
+
+	// The areas of textures that are no longer used are reused by other textures, instead of growing the atlas.
+	Rectanglef region_first;
+	{
+		Texture texture;
+		texture.Set("/assets/high_scores_alien_1.tga");
+		texture.AllowAtlas();
+		region_first = texture.GetTexCoordRegion();
+	}
+	Rml::ReleaseTextures();
+	for (int i = 0; i < 8; i++)
+	{
+		{
+			Texture texture;
+			texture.Set(CreateString(64, "/assets/unused_%d.tga", i));
+			texture.AllowAtlas();
+			CHECK(texture.GetTexCoordRegion() == region_first);
+		}
+		Rml::ReleaseTextures();
+	}
+	Rml::EnableTextureAtlas(0);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_render_dirty_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			display: block;
+		}
+		#box {
+			height: 50px;
+			background-color: #f00;
+		}
+		#hover:hover {
+			background-color: #0f0;
+		}
+		#scroll {
+			height: 20px;
+			overflow: auto;
+		}
+	</style>
+</head>
+
+<body>
+<div id="box"/>
+<div id="hover">Hover</div>
+<div id="text">Text</div>
+<div id="scroll"><div style="height: 100px"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.render_dirty")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_dirty_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto UpdateAndCheckDirty = [&]() {
+		context->Update();
+		const bool dirty = context->IsRenderDirty();
+		context->Render();
+		return dirty;
+	};
+
+	CHECK(UpdateAndCheckDirty());
+	CHECK(!UpdateAndCheckDirty());
+	CHECK(!UpdateAndCheckDirty());
+
+	document->GetElementById("box")->SetProperty("background-color", "#00f");
+	CHECK(UpdateAndCheckDirty());
+	CHECK(!UpdateAndCheckDirty());
+
+	document->GetElementById("text")->SetInnerRML("Changed");
+	CHECK(UpdateAndCheckDirty());
+	CHECK(!UpdateAndCheckDirty());
+
+	document->GetElementById("scroll")->SetScrollTop(10.f);
+	CHECK(UpdateAndCheckDirty());
+	CHECK(!UpdateAndCheckDirty());
+
+	// Moving the mouse over an element without any hover styles does not affect the rendered output.
+	context->ProcessMouseMove(10, 10, 0);
+	CHECK(!UpdateAndCheckDirty());
+
+	context->ProcessMouseMove(10, 60, 0);
+	CHECK(UpdateAndCheckDirty());
+	CHECK(!UpdateAndCheckDirty());
+
+	context->DirtyRender();
+	CHECK(UpdateAndCheckDirty());
+
+	document->Close();
+	CHECK(UpdateAndCheckDirty());
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_dirty_regions_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			display: block;
+			position: absolute;
+			left: 10px;
+			width: 100px;
+			height: 50px;
+			background-color: #f00;
+		}
+		#a { top: 10px; }
+		#b { top: 100px; }
+	</style>
+</head>
+
+<body>
+<div id="a"/>
+<div id="b"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.dirty_regions")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_dirty_regions_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* a = document->GetElementById("a");
+	Element* b = document->GetElementById("b");
+
+	context->EnableDirtyRegions(true);
+
+	auto UpdateAndGetRegions = [&]() {
+		context->Update();
+		Vector<Rectanglei> regions = context->GetDirtyRegions();
+		context->Render();
+		return regions;
+	};
+
+	const Rectanglei context_region = Rectanglei::FromSize(context->GetDimensions());
+
+	Vector<Rectanglei> regions = UpdateAndGetRegions();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0] == context_region);
+
+	CHECK(UpdateAndGetRegions().empty());
+
+	a->SetProperty("background-color", "#00f");
+	regions = UpdateAndGetRegions();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0] == Rectanglei::FromPositionSize({10, 10}, {100, 50}));
+	CHECK(UpdateAndGetRegions().empty());
+
+	// Both the previous and the new area of a moved element are dirty, overlapping regions are joined.
+	b->SetProperty("top", "90px");
+	regions = UpdateAndGetRegions();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0] == Rectanglei::FromPositionSize({10, 90}, {100, 60}));
+
+	b->SetProperty("top", "200px");
+	regions = UpdateAndGetRegions();
+	CHECK(regions.size() == 2);
+
+	b->SetProperty("display", "none");
+	regions = UpdateAndGetRegions();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0] == Rectanglei::FromPositionSize({10, 200}, {100, 50}));
+
+	a->DirtyRender();
+	regions = UpdateAndGetRegions();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0] == Rectanglei::FromPositionSize({10, 10}, {100, 50}));
+
+	context->DirtyRender();
+	regions = UpdateAndGetRegions();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0] == context_region);
+
+	if (TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface())
+	{
+		// When restricted to the dirty regions, nothing is rendered for an unchanged frame.
+		context->EnableDirtyRegions(true, true);
+		UpdateAndGetRegions();
+
+		render_interface->ResetCounters();
+		CHECK(UpdateAndGetRegions().empty());
+		CHECK(render_interface->GetCounters().render_calls == 0);
+		CHECK(render_interface->GetCounters().render_compiled_geometry == 0);
+
+		// Only the changed element is rendered, scissored to its region.
+		a->SetProperty("background-color", "#0f0");
+		render_interface->ResetCounters();
+		CHECK(UpdateAndGetRegions().size() == 1);
+		CHECK(render_interface->GetCounters().render_calls + render_interface->GetCounters().render_compiled_geometry == 1);
+		CHECK(render_interface->GetCounters().set_scissor >= 1);
+	}
+
+	context->EnableDirtyRegions(false);
+	CHECK(context->GetDirtyRegions().empty());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layer_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-family: LatoLatin;
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			display: block;
+			height: 20px;
+			background-color: #f00;
+		}
+		#panel {
+			layer: cached;
+			height: auto;
+			padding: 5px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="panel">
+	<div/>
+	<div id="inside"/>
+	<div/>
+</div>
+<div id="outside"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.layer_cached")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context);
+	if (!renderer)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layer_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = renderer->GetCounters();
+
+	// Without support for render targets, the layer is rendered directly.
+	renderer.RenderFrame();
+	CHECK(counters.create_render_target == 0);
+	CHECK(counters.render_calls == 5);
+
+	renderer->SetRenderTargetsEnabled(true);
+	document->GetElementById("panel")->DirtyRender();
+
+	// The panel and its children are rendered into the render target, then composited.
+	renderer.RenderFrame();
+	CHECK(counters.create_render_target == 1);
+	CHECK(counters.push_render_target == 1);
+	CHECK(counters.pop_render_target == 1);
+	CHECK(counters.render_calls == 6);
+
+	// Later frames only composite the layer.
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 0);
+	CHECK(counters.render_calls == 2);
+
+	// Changes outside the layer do not affect it.
+	document->GetElementById("outside")->SetProperty("background-color", "#0f0");
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 0);
+	CHECK(counters.render_calls == 2);
+
+	// Changes inside the layer render it again, reusing its render target.
+	document->GetElementById("inside")->SetProperty("background-color", "#0f0");
+	renderer.RenderFrame();
+	CHECK(counters.create_render_target == 0);
+	CHECK(counters.push_render_target == 1);
+	CHECK(counters.render_calls == 6);
+
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 0);
+
+	// A resized layer needs a new render target.
+	document->GetElementById("inside")->SetProperty("height", "40px");
+	renderer.RenderFrame();
+	CHECK(counters.release_texture == 1);
+	CHECK(counters.create_render_target == 1);
+	CHECK(counters.push_render_target == 1);
+
+	// Layers are composited through batched render commands as well.
+	renderer->SetBatchingEnabled(true);
+	renderer.RenderFrame();
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 0);
+	CHECK(counters.render_calls + counters.render_compiled_geometry == 2);
+
+	document->GetElementById("inside")->SetProperty("background-color", "#00f");
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 1);
+	renderer->SetBatchingEnabled(false);
+
+	// Geometry rendered into the layer while batching may have been compiled.
+	document->GetElementById("panel")->SetProperty("layer", "auto");
+	renderer.RenderFrame();
+	CHECK(counters.push_render_target == 0);
+	CHECK(counters.render_calls + counters.render_compiled_geometry == 5);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -31,6 +31,7 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <algorithm>
 #include <doctest.h>
 #include <map>
 
@@ -553,3 +554,381 @@ TEST_CASE("databinding.set_enum")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String for_contents_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 400px;
+			font-family: LatoLatin;
+		}
+	</style>
+</head>
+<body>
+<div data-model="basics">
+<div id="rows">
+	<div class="row" data-for="arrays.c" data-attr-title="it.val"><b>{{ it.val }}</b> &lt;{{ it_index }}&gt;<i data-for="x : arrays.a">{{ x }}</i></div>
+</div>
+<div id="select">
+	<div data-for="arrays.c"><select><option value="a">A</option><option value="b" selected>B</option></select></div>
+</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for_contents")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	REQUIRE(InitializeDataBindings(context));
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_contents_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	// The contents of each row should be instanced from the data-for template, with entities decoded and data views applied.
+	ElementList rows;
+	document->QuerySelectorAll(rows, "#rows .row:not([data-for])");
+	REQUIRE(rows.size() == 3);
+	for (int i = 0; i < 3; i++)
+	{
+		const String value = "c" + ToString(i + 1);
+		CHECK(rows[i]->GetAttribute<String>("title", "") == value);
+		CHECK(rows[i]->GetInnerRML() == "<b>" + value + "</b> &lt;" + ToString(i) + "&gt;<i>10</i><i>11</i><i>12</i><i data-for=\"x : arrays.a\" />");
+	}
+
+	// Elements with custom node handlers must still be constructed as if set using inner RML.
+	ElementList select_elements;
+	document->QuerySelectorAll(select_elements, "#select select");
+	REQUIRE(select_elements.size() == 3);
+	for (Element* select : select_elements)
+		CHECK(select->GetAttribute<String>("value", "") == "b");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String for_key_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 400px;
+			font-family: LatoLatin;
+		}
+	</style>
+</head>
+<body>
+<div data-model="keyed" id="list">
+	<p data-for="item, i : items" data-for-key="item.id">{{ i }}: {{ item.name }}<span data-for="tag : item.tags">{{ tag }}</span></p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for_key")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Item {
+		int id;
+		String name;
+		Vector<String> tags;
+	};
+	Vector<Item> items = {{1, "a", {"x"}}, {2, "b", {}}, {3, "c", {"y", "z"}}};
+
+	DataModelConstructor constructor = context->CreateDataModel("keyed");
+	REQUIRE(constructor);
+	constructor.RegisterArray<Vector<String>>();
+	if (auto handle = constructor.RegisterStruct<Item>())
+	{
+		handle.RegisterMember("id", &Item::id);
+		handle.RegisterMember("name", &Item::name);
+		handle.RegisterMember("tags", &Item::tags);
+	}
+	constructor.RegisterArray<Vector<Item>>();
+	constructor.Bind("items", &items);
+	DataModelHandle keyed_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_key_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	Element* list = document->GetElementById("list");
+	auto GetRows = [&]() {
+		ElementList rows;
+		list->QuerySelectorAll(rows, "p:not([data-for])");
+		return rows;
+	};
+	auto GetRowsRML = [&]() {
+		String result;
+		for (Element* row : GetRows())
+			result += '[' + row->GetInnerRML() + ']';
+		return result;
+	};
+
+	const ElementList initial_rows = GetRows();
+	REQUIRE(initial_rows.size() == 3);
+	CHECK(GetRowsRML() == "[0: a<span>x</span><span data-for=\"tag : item.tags\" />][1: b<span data-for=\"tag : item.tags\" />]"
+						  "[2: c<span>y</span><span>z</span><span data-for=\"tag : item.tags\" />]");
+
+	// Rows should be moved along with their items, without being reconstructed.
+	initial_rows[0]->SetClass("marked", true);
+	std::reverse(items.begin(), items.end());
+	keyed_handle.DirtyVariable("items");
+	TestsShell::RenderLoop();
+
+	ElementList rows = GetRows();
+	REQUIRE(rows.size() == 3);
+	CHECK(rows[0] == initial_rows[2]);
+	CHECK(rows[1] == initial_rows[1]);
+	CHECK(rows[2] == initial_rows[0]);
+	CHECK(rows[2]->IsClassSet("marked"));
+	CHECK(GetRowsRML() == "[0: c<span>y</span><span>z</span><span data-for=\"tag : item.tags\" />][1: b<span data-for=\"tag : item.tags\" />]"
+						  "[2: a<span>x</span><span data-for=\"tag : item.tags\" />]");
+
+	// Only new items should construct rows, and only removed items should destroy them.
+	items.erase(items.begin() + 1);
+	items.insert(items.begin(), Item{4, "d", {"w"}});
+	items[2].tags.push_back("v");
+	keyed_handle.DirtyVariable("items");
+	TestsShell::RenderLoop();
+
+	rows = GetRows();
+	REQUIRE(rows.size() == 3);
+	CHECK(rows[1] == initial_rows[2]);
+	CHECK(rows[2] == initial_rows[0]);
+	CHECK(GetRowsRML() == "[0: d<span>w</span><span data-for=\"tag : item.tags\" />]"
+						  "[1: c<span>y</span><span>z</span><span data-for=\"tag : item.tags\" />]"
+						  "[2: a<span>x</span><span>v</span><span data-for=\"tag : item.tags\" />]");
+
+	items.clear();
+	keyed_handle.DirtyVariable("items");
+	TestsShell::RenderLoop();
+	CHECK(GetRows().empty());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String for_virtual_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 400px;
+			font-family: LatoLatin;
+		}
+		#list {
+			height: 100px;
+			overflow-y: auto;
+		}
+		.row {
+			display: block;
+			height: 20px;
+		}
+	</style>
+</head>
+<body>
+<div data-model="virtual" id="list">
+	<div class="row" data-for="item : items" data-for-virtual="2">{{ it_index }}: {{ item }}</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for_virtual")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> items(1000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = 10 * i;
+
+	DataModelConstructor constructor = context->CreateDataModel("virtual");
+	REQUIRE(constructor);
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("items", &items);
+	DataModelHandle virtual_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_virtual_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+	auto GetRows = [&]() {
+		ElementList rows;
+		list->QuerySelectorAll(rows, ".row:not([data-for])");
+		return rows;
+	};
+
+	// The first update only instances a few rows to measure, once measured the view should settle on the visible range.
+	for (int i = 0; i < 3; i++)
+		TestsShell::RenderLoop();
+
+	// Five visible rows, plus two overscan rows after them.
+	ElementList rows = GetRows();
+	REQUIRE(rows.size() == 7);
+	CHECK(rows[0]->GetInnerRML() == "0: 0");
+	CHECK(rows[6]->GetInnerRML() == "6: 60");
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * items.size()));
+
+	// The spacers in front of and after the rows should not affect structural selectors.
+	CHECK(list->QuerySelector(".row:first-child") == rows[0]);
+	CHECK(list->QuerySelector(".row:nth-child(2)") == rows[1]);
+
+	// Rows should be recycled for the new range when scrolled.
+	list->SetScrollTop(20.f * 500);
+	TestsShell::RenderLoop();
+
+	rows = GetRows();
+	REQUIRE(rows.size() == 9);
+	CHECK(rows[0]->GetInnerRML() == "498: 4980");
+	CHECK(rows[8]->GetInnerRML() == "506: 5060");
+	CHECK(rows[2]->GetAbsoluteTop() == doctest::Approx(list->GetAbsoluteTop()));
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * items.size()));
+
+	// Shrinking the container should reduce the range accordingly.
+	items.resize(502);
+	virtual_handle.DirtyVariable("items");
+	for (int i = 0; i < 3; i++)
+		TestsShell::RenderLoop();
+
+	rows = GetRows();
+	REQUIRE(!rows.empty());
+	CHECK(rows.back()->GetInnerRML() == "501: 5010");
+	CHECK(rows.back()->GetOffsetTop() == doctest::Approx(20.f * 501));
+
+	// Releasing the view should also remove its spacers.
+	auto CountSpacers = [&]() {
+		int count = 0;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+			count += (list->GetChild(i)->GetTagName() == "#spacer");
+		return count;
+	};
+	CHECK(CountSpacers() == 2);
+	context->RemoveDataModel("virtual");
+	CHECK(CountSpacers() == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String variable_handle_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+
+<body>
+<div data-model="handles">
+	<p id="a">{{ a }}</p>
+	<p id="b">{{ b }}</p>
+	<p id="sum">{{ a + b }}</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.variable_handle")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	int a = 1;
+	int b = 2;
+
+	DataModelConstructor constructor = context->CreateDataModel("handles");
+	REQUIRE(constructor);
+	constructor.Bind("a", &a);
+	constructor.Bind("b", &b);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(variable_handle_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	Element* element_a = document->GetElementById("a");
+	Element* element_b = document->GetElementById("b");
+	Element* element_sum = document->GetElementById("sum");
+	CHECK(element_sum->GetInnerRML() == "3");
+
+	const DataVariableHandle handle_a = handle.GetVariableHandle("a");
+	CHECK(handle_a);
+	CHECK(!DataVariableHandle());
+	CHECK(!handle.IsVariableDirty(handle_a));
+
+	// Dirtying by handle and by name should be interchangeable.
+	a = 10;
+	handle.DirtyVariable(handle_a);
+	CHECK(handle.IsVariableDirty(handle_a));
+	CHECK(handle.IsVariableDirty("a"));
+	CHECK(!handle.IsVariableDirty("b"));
+
+	TestsShell::RenderLoop();
+	CHECK(!handle.IsVariableDirty(handle_a));
+	CHECK(element_a->GetInnerRML() == "10");
+	CHECK(element_b->GetInnerRML() == "2");
+	CHECK(element_sum->GetInnerRML() == "12");
+
+	b = 20;
+	handle.DirtyVariable("b");
+	CHECK(handle.IsVariableDirty(handle.GetVariableHandle("b")));
+	TestsShell::RenderLoop();
+	CHECK(element_b->GetInnerRML() == "20");
+	CHECK(element_sum->GetInnerRML() == "30");
+
+	// Handles to unbound variables, default handles, and handles from other models are rejected.
+	int c = 3;
+	DataModelConstructor other_constructor = context->CreateDataModel("other_handles");
+	REQUIRE(other_constructor);
+	other_constructor.Bind("a", &c);
+	const DataVariableHandle other_handle_a = other_constructor.GetModelHandle().GetVariableHandle("a");
+	CHECK(other_handle_a);
+
+	TestsShell::SetNumExpectedWarnings(5);
+	CHECK(!handle.GetVariableHandle("c"));
+	CHECK(!handle.IsVariableDirty(DataVariableHandle()));
+	CHECK(!handle.IsVariableDirty(other_handle_a));
+	handle.DirtyVariable(DataVariableHandle());
+	handle.DirtyVariable(other_handle_a);
+	CHECK(!handle.IsVariableDirty("a"));
+	CHECK(!other_constructor.GetModelHandle().IsVariableDirty(other_handle_a));
+	TestsShell::SetNumExpectedWarnings(0);
+	context->RemoveDataModel("other_handles");
+
+	// Views of removed elements should no longer be updated.
+	element_sum->GetParentNode()->RemoveChild(element_sum);
+	a = 100;
+	handle.DirtyVariable(handle_a);
+	handle.DirtyVariable(handle_a);
+	TestsShell::RenderLoop();
+	CHECK(element_a->GetInnerRML() == "100");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -275,6 +275,20 @@ TEST_CASE("Element")
 		CHECK(clone->GetProperty<String>("background-color") == "0, 0, 255, 255");
 	}
 
+	SUBCASE("ClassNotInStyleSheet")
+	{
+		// Classes not used by any style sheet are not interned when set, but they are still matched by selectors parsed afterwards.
+		Element* element = document->GetFirstChild();
+		element->SetClass("runtime-class", true);
+		CHECK(element->IsClassSet("runtime-class"));
+		CHECK(element->GetClassNames() == "runtime-class");
+		CHECK(document->QuerySelector(".runtime-class") == element);
+
+		element->SetClass("runtime-class", false);
+		CHECK_FALSE(element->IsClassSet("runtime-class"));
+		CHECK(document->QuerySelector(".runtime-class") == nullptr);
+	}
+
 	SUBCASE("SetInnerRML")
 	{
 		Element* element = document->GetFirstChild();
@@ -421,3 +435,101 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_clip_culling_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			width: 400px;
+			height: 400px;
+		}
+		#list {
+			overflow: hidden;
+			height: 100px;
+		}
+		#list div, #layer div {
+			height: 20px;
+			background-color: #f00;
+		}
+		#outer {
+			overflow: hidden;
+			height: 50px;
+		}
+		#layer {
+			position: relative;
+			z-index: 1;
+			overflow: hidden;
+			height: 100px;
+			margin-top: 100px;
+		}
+		#layer div.unclipped {
+			clip: none;
+		}
+	</style>
+</head>
+
+<body>
+<div id="list"/>
+<div id="outer">
+	<div id="layer"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.RenderClipCulling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::DummyRenderer renderer(context);
+	if (!renderer)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_clip_culling_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+	Element* layer = document->GetElementById("layer");
+
+	auto SetRows = [](Element* element, int num_rows) {
+		String rml;
+		for (int i = 0; i < num_rows; i++)
+			rml += "<div/>";
+		element->SetInnerRML(rml);
+	};
+	auto CountRenderCalls = [&]() {
+		renderer.RenderFrame();
+		return renderer->GetCounters().render_calls;
+	};
+
+	// Only the five rows visible in the list should be rendered, regardless of the total number of rows.
+	SetRows(list, 10);
+	const size_t render_calls_visible = CountRenderCalls();
+	CHECK(render_calls_visible == 5);
+
+	SetRows(list, 1000);
+	CHECK(CountRenderCalls() == render_calls_visible);
+
+	list->SetScrollTop(20.f * 500);
+	CHECK(CountRenderCalls() == render_calls_visible);
+
+	list->SetScrollTop(20.f * 500 + 10.f);
+	CHECK(CountRenderCalls() == render_calls_visible + 1);
+
+	// The layer lies outside the clipping region of its parent, thus it should be skipped together with its stacking context.
+	SetRows(layer, 10);
+	CHECK(CountRenderCalls() == render_calls_visible + 1);
+
+	// Unclipped elements should be rendered even if their stacking context parent is clipped away.
+	layer->AppendChild(document->CreateElement("div"))->SetClass("unclipped", true);
+	CHECK(CountRenderCalls() == render_calls_visible + 2);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
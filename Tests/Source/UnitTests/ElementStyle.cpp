@@ -27,6 +27,7 @@
  */
 
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -84,3 +85,71 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_style_sharing_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { font-size: 10px; }
+		.row { width: 10px; height: 10px; }
+		.row.odd { width: 20px; }
+		.row:first-child { height: 20px; }
+		.row[selected] { height: 30px; }
+		.marker + .row { height: 40px; }
+		.row:hover { width: 50px; }
+		#special { width: 60px; }
+		.list .row span { width: 1em; }
+	</style>
+</head>
+
+<body class="list">
+<div class="row"><span/></div>
+<div class="row odd"><span/></div>
+<div class="row"><span/></div>
+<div class="row odd" selected><span/></div>
+<div class="row"><span/></div>
+<div class="row marker"><span/></div>
+<div class="row"><span/></div>
+<div class="row" id="special"><span/></div>
+<div class="row" style="font-size: 20px;"><span/></div>
+<div class="row"><span/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.style_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Siblings with identical names may share styles, make sure this doesn't leak into siblings affected by their position, attributes, or id.
+	ElementDocument* document = context->LoadDocumentFromMemory(document_style_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const float expected_widths[] = {10, 20, 10, 20, 10, 10, 10, 60, 10, 10};
+	const float expected_heights[] = {20, 10, 10, 30, 10, 10, 40, 10, 10, 10};
+	const float expected_span_widths[] = {10, 10, 10, 10, 10, 10, 10, 10, 20, 10};
+
+	REQUIRE(document->GetNumChildren() == 10);
+	for (int i = 0; i < document->GetNumChildren(); i++)
+	{
+		Element* row = document->GetChild(i);
+		CAPTURE(i);
+		CHECK(row->GetComputedValues().width().value == expected_widths[i]);
+		CHECK(row->GetComputedValues().height().value == expected_heights[i]);
+		CHECK(row->GetChild(0)->GetComputedValues().width().value == expected_span_widths[i]);
+	}
+
+	// Changing the pseudo classes of a single element should only affect that element.
+	document->GetChild(4)->SetPseudoClass("hover", true);
+	context->Update();
+	CHECK(document->GetChild(2)->GetComputedValues().width().value == 10);
+	CHECK(document->GetChild(4)->GetComputedValues().width().value == 50);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -27,6 +27,7 @@
  */
 
 #include "../../../Source/Core/GeometryDatabase.h"
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Geometry.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
@@ -66,3 +67,64 @@ TEST_CASE("Geometry database")
 	geometry_list.clear();
 	CHECK(ListMatchesDatabase(geometry_list));
 }
+
+TEST_CASE("Geometry database pages")
+{
+	REQUIRE(GeometryDatabase::PrepareForTests());
+
+	using GeometryDatabase::GetStats;
+
+	CHECK(GetStats().num_pages == 0);
+
+	{
+		Vector<Geometry> geometry_list(200);
+		for (auto& geometry : geometry_list)
+			geometry.GetVertices().resize(4);
+
+		const GeometryMemoryStats stats = GetStats();
+		CHECK(stats.num_pages == 2);
+		CHECK(stats.num_geometry == 200);
+		CHECK(stats.num_free_slots == 56);
+		CHECK(stats.used_bytes == 200 * 4 * sizeof(Vertex));
+		CHECK(stats.GetFragmentation() == 0.f);
+
+		// The buffers of erased geometry keep their memory for new geometry.
+		geometry_list.resize(100);
+		CHECK(GetStats().num_geometry == 100);
+		CHECK(GetStats().used_bytes == 100 * 4 * sizeof(Vertex));
+		CHECK(GetStats().reserved_bytes == 200 * 4 * sizeof(Vertex));
+		CHECK(GetStats().GetFragmentation() == doctest::Approx(0.5f));
+
+		Geometry geometry;
+		CHECK(geometry.GetVertices().capacity() == 4);
+		CHECK(geometry.GetVertices().empty());
+		geometry.GetVertices().resize(4);
+
+		// Compacting releases the memory of free slots, and the trailing pages without any geometry.
+		GeometryDatabase::Compact();
+		CHECK(GetStats().num_pages == 2);
+		CHECK(GetStats().num_geometry == 101);
+		CHECK(GetStats().reserved_bytes == 101 * 4 * sizeof(Vertex));
+
+		geometry_list.clear();
+		GeometryDatabase::Compact();
+		CHECK(GetStats().num_pages == 2);
+
+		// Large buffers are released when their geometry is erased, rather than being kept reserved by the free slot.
+		const size_t reserved_bytes = GetStats().reserved_bytes;
+		{
+			Geometry large_geometry;
+			large_geometry.GetVertices().resize(10000);
+			large_geometry.GetIndices().resize(15000);
+			CHECK(GetStats().reserved_bytes >= reserved_bytes + 10000 * sizeof(Vertex) + 15000 * sizeof(int));
+		}
+		CHECK(GetStats().reserved_bytes == reserved_bytes);
+
+		// The statistics are also available through the public API.
+		CHECK(Rml::GetGeometryMemoryStats().num_geometry == 1);
+	}
+
+	CHECK(GetStats().num_geometry == 0);
+	GeometryDatabase::Compact();
+	CHECK(GetStats().num_pages == 0);
+}
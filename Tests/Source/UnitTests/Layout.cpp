@@ -138,3 +138,196 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 500px;
+			height: 300px;
+		}
+		.panel {
+			width: 200px;
+			height: 100px;
+			overflow: hidden;
+		}
+		#positioned { position: relative; }
+		.absolute { position: absolute; top: 10px; left: 10px; width: 50px; }
+	</style>
+</head>
+
+<body>
+<div id="before">Before</div>
+<div class="panel" id="positioned">
+	<p id="first">Lorem</p>
+	<p id="second">Ipsum</p>
+	<div class="absolute" id="abs_inside">Abs</div>
+</div>
+<div class="panel" id="static">
+	<p id="third">Lorem</p>
+	<div class="absolute" id="abs_escaping">Abs</div>
+</div>
+<div id="after">After</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* after = document->GetElementById("after");
+	Element* second = document->GetElementById("second");
+	Element* abs_inside = document->GetElementById("abs_inside");
+	Element* abs_escaping = document->GetElementById("abs_escaping");
+
+	const Vector2f after_offset = after->GetAbsoluteOffset();
+	const float second_top = second->GetAbsoluteTop();
+	const Vector2f abs_inside_offset = abs_inside->GetAbsoluteOffset();
+	const Vector2f abs_escaping_offset = abs_escaping->GetAbsoluteOffset();
+
+	// Changes within the fixed-size panels should only affect their contents.
+	const String lorem_ipsum = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore.";
+	document->GetElementById("first")->SetInnerRML(lorem_ipsum);
+	document->GetElementById("third")->SetInnerRML(lorem_ipsum);
+	TestsShell::RenderLoop();
+
+	const float second_top_incremental = second->GetAbsoluteTop();
+	CHECK(second_top_incremental > second_top);
+	CHECK(after->GetAbsoluteOffset() == after_offset);
+	CHECK(abs_inside->GetAbsoluteOffset() == abs_inside_offset);
+	CHECK(abs_escaping->GetAbsoluteOffset() == abs_escaping_offset);
+	CHECK(document->GetElementById("positioned")->GetBox().GetSize() == Vector2f(200.f, 100.f));
+
+	// Formatting the whole document should give the same result.
+	document->SetProperty("width", "500px");
+	TestsShell::RenderLoop();
+
+	CHECK(second->GetAbsoluteTop() == second_top_incremental);
+	CHECK(after->GetAbsoluteOffset() == after_offset);
+	CHECK(abs_inside->GetAbsoluteOffset() == abs_inside_offset);
+	CHECK(abs_escaping->GetAbsoluteOffset() == abs_escaping_offset);
+
+	// Resizing a panel itself affects the layout outside of it.
+	document->GetElementById("static")->SetProperty("height", "150px");
+	TestsShell::RenderLoop();
+
+	CHECK(after->GetAbsoluteTop() == after_offset.y + 50.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_cache_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 500px;
+			height: 400px;
+		}
+		.flex { display: flex; }
+		.flex > div { flex: 1; margin: 5px; }
+		.inline { display: inline-block; }
+		table { display: table; width: 300px; }
+		tr { display: table-row; }
+		td { display: table-cell; }
+		.container { position: relative; overflow: auto; height: 50px; }
+		.absolute { position: absolute; top: 5px; right: 5px; }
+	</style>
+</head>
+<body>
+<p id="header">Header</p>
+<div class="flex">
+	<div id="item">Item</div>
+	<div>Second item<span class="inline">Inline</span></div>
+</div>
+<table>
+	<tr><td id="cell">A</td><td>B</td></tr>
+	<tr><td>C</td><td>D</td></tr>
+</table>
+<div class="container">
+	<div class="absolute">Absolute</div>
+	<span class="inline" id="inline">Inline</span>
+</div>
+</body>
+</rml>
+)";
+
+static void CheckEqualLayout(Element* element, Element* reference)
+{
+	REQUIRE(element->GetNumChildren() == reference->GetNumChildren());
+	CHECK_MESSAGE(element->GetBox() == reference->GetBox(), element->GetAddress());
+	CHECK_MESSAGE(element->GetRelativeOffset() == reference->GetRelativeOffset(), element->GetAddress());
+
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		CheckEqualLayout(element->GetChild(i), reference->GetChild(i));
+}
+
+TEST_CASE("Layout.Cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_cache_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// Apply the change to the formatted document, and compare it to a new document formatted from scratch with all the same changes.
+	Vector<Function<void(ElementDocument*)>> changes;
+	auto CheckChange = [&](const Function<void(ElementDocument*)>& change) {
+		ElementDocument* reference = context->LoadDocumentFromMemory(document_layout_cache_rml);
+		REQUIRE(reference);
+		reference->Show();
+
+		changes.push_back(change);
+		change(document);
+		for (auto& reference_change : changes)
+			reference_change(reference);
+		context->Update();
+
+		CheckEqualLayout(document, reference);
+		reference->Close();
+		context->Update();
+	};
+
+	SUBCASE("Unrelated")
+	{
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("header")->SetInnerRML("Header<br/>with multiple<br/>lines"); });
+	}
+	SUBCASE("FlexItem")
+	{
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("item")->SetInnerRML("Flex item with longer content, which should wrap"); });
+	}
+	SUBCASE("TableCell")
+	{
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("cell")->SetInnerRML("A<br/>B"); });
+	}
+	SUBCASE("InlineBlock")
+	{
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("inline")->SetProperty("padding", "10px"); });
+	}
+	SUBCASE("Repeated")
+	{
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("header")->SetInnerRML("Header<br/>with multiple<br/>lines"); });
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("cell")->SetInnerRML("A<br/>B"); });
+		CheckChange([](ElementDocument* doc) { doc->GetElementById("item")->SetInnerRML("Flex item with longer content, which should wrap"); });
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
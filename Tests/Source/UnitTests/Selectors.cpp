@@ -31,6 +31,7 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 
@@ -200,6 +201,10 @@ static const Vector<QuerySelector> query_selectors =
 	{ "#F ~ #B",                     "" },
 	{ "div.parent > #B ~ p:empty",   "C G H",           SelectorOp::InsertElementBefore,  "H",     "C G Inserted H" },
 	{ "div.parent > #B ~ * span",    "D0 D1 F0" },
+	{ ".hello ~ .parent span",       "D0 D1 F0",        SelectorOp::InsertElementBefore,  "D0",    "D0 D1 F0" },
+	{ "#Z ~ div #D1",                "D1",              SelectorOp::InsertElementBefore,  "D1",    "D1" },
+	{ ".hello + .parent > p",        "B C D F G H",     SelectorOp::InsertElementBefore,  "B",     "Inserted B C D F G H" },
+	{ "#Z + div > h3",               "E",               SelectorOp::InsertElementBefore,  "E",     "E" },
 
 	{ ":not(*)",                     "" },
 	{ ":not(span)",                  "X Z P A B C D E F G H I" },
@@ -214,6 +219,14 @@ static const Vector<QuerySelector> query_selectors =
 	{ ":hover + #P #D1",             "",                SelectorOp::SetHover,             "Z", "D1"  },
 	{ ":not(:hover) + #P #D1",       "D1",              SelectorOp::SetHover,             "Z", ""  },
 	{ "#X + #Y",                     "Y",               SelectorOp::RemoveId,             "X", ""  },
+	{ ":hover > span",               "",                SelectorOp::SetHover,             "D", "D0 D1"  },
+	{ "#P :hover span",              "",                SelectorOp::SetHover,             "F", "F0"  },
+	{ ":hover ~ h3",                 "",                SelectorOp::SetHover,             "B", "E"  },
+	{ ".parent p span",              "D0 D1 F0",        SelectorOp::RemoveClasses,        "parent", ""  },
+	{ ".hello ~ *",                  "Y Z P I",         SelectorOp::RemoveClasses,        "hello", ""  },
+	{ ".parent p + h3",              "E",               SelectorOp::RemoveClasses,        "parent", ""  },
+	{ "body #P > #D span",           "D0 D1" },
+	{ ".parent :hover ~ h3",         "",                SelectorOp::SetHover,             "B", "E"  },
 
 	{ "p[unit=m]",                   "B",               SelectorOp::RemoveAttributeUnit,  "B", ""  },
 	{ "p[unit=m] + *",               "C",               SelectorOp::RemoveAttributeUnit,  "B", ""  },
@@ -376,6 +389,31 @@ TEST_CASE("Selectors")
 		}
 	}
 
+	SUBCASE("Invalidation sets")
+	{
+		const String selector_css = ".a .b { drag: drag; } .c + .d { drag: drag; } .e:hover { drag: drag; } .g { } .g > .h { drag: drag; } "
+									"p:not(.f) { drag: drag; }";
+		ElementDocument* document = context->LoadDocumentFromMemory(doc_begin + selector_css + doc_end);
+		REQUIRE(document);
+
+		const StyleSheet* style_sheet = document->GetStyleSheet();
+		REQUIRE(style_sheet);
+
+		CHECK(style_sheet->GetClassInvalidation("a") == StyleInvalidation::Descendants);
+		CHECK(style_sheet->GetClassInvalidation("b") == StyleInvalidation::Self);
+		CHECK(style_sheet->GetClassInvalidation("c") == StyleInvalidation::Siblings);
+		CHECK(style_sheet->GetClassInvalidation("d") == StyleInvalidation::Self);
+		CHECK(style_sheet->GetClassInvalidation("e") == StyleInvalidation::Self);
+		CHECK(style_sheet->GetClassInvalidation("f") == StyleInvalidation::All);
+		CHECK(style_sheet->GetClassInvalidation("g") == StyleInvalidation::Descendants);
+		CHECK(style_sheet->GetClassInvalidation("h") == StyleInvalidation::Self);
+		CHECK(style_sheet->GetClassInvalidation("hello") == StyleInvalidation::None);
+		CHECK(style_sheet->GetPseudoClassInvalidation("hover") == StyleInvalidation::Self);
+		CHECK(style_sheet->GetPseudoClassInvalidation("active") == StyleInvalidation::None);
+
+		context->UnloadDocument(document);
+	}
+
 	SUBCASE("QuerySelector(All)")
 	{
 		const String document_string = doc_begin + doc_end;